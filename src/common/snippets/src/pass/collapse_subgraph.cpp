@@ -32,6 +32,16 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    // the dynamic outputs are known to be broadcastable only if they have the same shape
+    const bool has_dynamic_outputs = std::any_of(std::begin(outputs), std::end(outputs), [](const Output<const Node>& output) {
+        return output.get_partial_shape().is_dynamic();
+    });
+    if (has_dynamic_outputs) {
+        const auto& ref_shape = outputs.begin()->get_partial_shape();
+        return std::any_of(std::begin(outputs), std::end(outputs), [&ref_shape](const Output<const Node>& output) {
+            return !output.get_partial_shape().same_scheme(ref_shape);
+        });
+    }
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -106,8 +116,9 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
 
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
     auto supported = [](descriptor::Tensor& t) -> bool {
+        // the dynamic dimensions are supported, the kernels are generated for the actual shapes in runtime
         return t.get_element_type() == ngraph::element::f32 &&
-               t.get_partial_shape().is_static();
+               t.get_partial_shape().rank().is_static();
     };
     const auto & inputs = n->inputs();
     const auto & outputs = n->outputs();
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read only memory mapping of the whole file. The mapping is released together with the object.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns pointer to the mapped data, nullptr for the empty file
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns size of the mapped data in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the file into memory
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory
+ * @throws std::runtime_error if the file can't be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the file with the wide char name into memory
+ * @param path Full or relative path to the file
+ * @return Reference to the mapped memory
+ * @throws std::runtime_error if the file can't be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief The file stream which also keeps the memory mapping of the whole file.
+ * The readers which know about it can alias the mapped data instead of reading it, the other ones read the stream as
+ * usual.
+ */
+class MmapStream final : public std::ifstream {
+public:
+    /**
+     * @param path Full or relative path to the file
+     * @throws std::runtime_error if the file can't be opened or mapped
+     */
+    explicit MmapStream(const std::string& path)
+        : std::ifstream(path, std::ios_base::binary),
+          m_memory(load_mmap_object(path)) {}
+
+    /**
+     * @brief Returns the mapping of the file, the stream positions are the offsets in it
+     */
+    const std::shared_ptr<MappedMemory>& get_memory() const {
+        return m_memory;
+    }
+
+private:
+    std::shared_ptr<MappedMemory> m_memory;
+};
+
+}  // namespace util
+}  // namespace ov
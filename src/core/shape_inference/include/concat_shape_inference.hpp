@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/concat.hpp>
+
+#include "utils.hpp"
+namespace ov {
+namespace op {
+namespace v0 {
+
+template <class T>
+void shape_infer(const Concat* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, output_shapes.size() == 1);
+    NODE_VALIDATION_CHECK(op, !input_shapes.empty(), "At least one argument required.");
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    auto& output_shape = output_shapes[0];
+
+    bool is_rank_known = false;
+    int64_t concat_axis = 0;
+    DimType concat_dim{0};
+    for (size_t i = 0; i < input_shapes.size(); ++i) {
+        const auto& input_shape = input_shapes[i];
+        const auto input_rank = input_shape.rank();
+        if (input_rank.is_dynamic()) {
+            concat_dim += Dimension::dynamic();
+            continue;
+        }
+        const auto rank = input_rank.get_length();
+        concat_axis = op->get_axis() < 0 ? op->get_axis() + rank : op->get_axis();
+        NODE_VALIDATION_CHECK(op,
+                              concat_axis < rank && concat_axis >= 0,
+                              "Concatenation axis (",
+                              concat_axis,
+                              ") is out of bounds [",
+                              -rank,
+                              ", ",
+                              rank - 1,
+                              "] for ",
+                              "argument ",
+                              i,
+                              ", which has shape ",
+                              input_shape,
+                              ".");
+
+        if (!is_rank_known) {
+            output_shape = input_shape;
+            is_rank_known = true;
+        } else {
+            bool is_mergeable = static_cast<int64_t>(output_shape.size()) == rank;
+            for (int64_t d = 0; is_mergeable && d < rank; ++d) {
+                if (d != concat_axis)
+                    is_mergeable = DimType::merge(output_shape[d], output_shape[d], input_shape[d]);
+            }
+            NODE_VALIDATION_CHECK(op,
+                                  is_mergeable,
+                                  "Argument shapes are inconsistent; they must have the same rank, and must "
+                                  "have ",
+                                  "equal dimension everywhere except on the concatenation axis (axis ",
+                                  concat_axis,
+                                  ").");
+        }
+        concat_dim += input_shape[concat_axis];
+    }
+
+    if (is_rank_known) {
+        output_shape[concat_axis] = concat_dim;
+    } else {
+        output_shape = ov::PartialShape::dynamic();
+    }
+}
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/util/embeddingbag_packed_base.hpp>
+
+#include "utils.hpp"
+namespace ov {
+namespace op {
+namespace util {
+
+template <class T>
+void shape_infer(const ov::op::util::EmbeddingBagPackedBase* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes) {
+    const auto input_size = input_shapes.size();
+
+    NODE_VALIDATION_CHECK(op, (input_size == 2 || input_size == 3) && output_shapes.size() == 1);
+
+    static constexpr int EMB_TABLE = 0;
+    static constexpr int INDICES = 1;
+    static constexpr int PER_SAMPLE_WEIGHTS = 2;
+
+    NODE_VALIDATION_CHECK(op, input_shapes[INDICES].rank().compatible(2), "INDICES must be 2D");
+
+    if (input_size == 3) {
+        NODE_VALIDATION_CHECK(op,
+                              input_shapes[PER_SAMPLE_WEIGHTS].rank().compatible(2),
+                              "PER_SAMPLE_WEIGHTS must be 2D");
+
+        NODE_VALIDATION_CHECK(op,
+                              input_shapes[INDICES].compatible(input_shapes[PER_SAMPLE_WEIGHTS]),
+                              "INDICES and PER_SAMPLE_WEIGHTS shape must be same");
+    }
+
+    const auto& emb_table_shape = input_shapes[EMB_TABLE];
+    const auto& indices_shape = input_shapes[INDICES];
+
+    if (emb_table_shape.rank().is_static()) {
+        output_shapes[0] = emb_table_shape;
+        output_shapes[0][0] = indices_shape.rank().is_static() ? indices_shape[0] : Dimension::dynamic();
+    } else {
+        output_shapes[0] = PartialShape::dynamic();
+    }
+}
+}  // namespace util
+}  // namespace op
+}  // namespace ov
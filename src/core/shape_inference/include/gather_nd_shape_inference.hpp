@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/gather_nd.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace gather_nd {
+
+/**
+ * @brief Infers the output shape of GatherND, which keeps the batch dimensions apart: the batch dimensions, the
+ * dimensions of the indices but the last one and the dimensions of the data slices.
+ */
+template <class T>
+void shape_infer_base(const util::GatherNDBase* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& data_shape = input_shapes[0];
+    const auto& indices_shape = input_shapes[1];
+    auto& output_shape = output_shapes[0];
+    const auto batch_dims = static_cast<int64_t>(op->get_batch_dims());
+
+    if (data_shape.rank().is_static()) {
+        NODE_VALIDATION_CHECK(op, data_shape.size() > 0, "Data rank must be at least 1.");
+        NODE_VALIDATION_CHECK(op,
+                              static_cast<int64_t>(data_shape.size()) > batch_dims,
+                              "Number of batch dimensions must not exceed a rank of data.");
+    }
+    if (indices_shape.rank().is_static()) {
+        NODE_VALIDATION_CHECK(op, indices_shape.size() > 0, "Indices rank must be at least 1.");
+        NODE_VALIDATION_CHECK(op,
+                              static_cast<int64_t>(indices_shape.size()) > batch_dims,
+                              "Number of batch dimensions must not exceed a rank of indices.");
+    }
+
+    if (data_shape.rank().is_dynamic() || indices_shape.rank().is_dynamic() ||
+        indices_shape[indices_shape.size() - 1].is_dynamic()) {
+        output_shape = ov::PartialShape::dynamic();
+        return;
+    }
+
+    const auto tuple_length = static_cast<int64_t>(indices_shape[indices_shape.size() - 1].get_length());
+    NODE_VALIDATION_CHECK(op,
+                          tuple_length + batch_dims <= static_cast<int64_t>(data_shape.size()),
+                          "Length of a tuple with indices must not exceed a rank of data tensor excluding batch "
+                          "dimensions.");
+
+    const auto indices_length = static_cast<int64_t>(indices_shape.size()) - batch_dims - 1;
+    const auto slice_length = static_cast<int64_t>(data_shape.size()) - tuple_length - batch_dims;
+    output_shape.resize(batch_dims + indices_length + slice_length);
+    for (int64_t dim = 0; dim < batch_dims; dim++) {
+        NODE_VALIDATION_CHECK(op,
+                              DimType::merge(output_shape[dim], data_shape[dim], indices_shape[dim]),
+                              "Batch dimensions of data and indices must be the same.");
+    }
+    for (int64_t dim = 0; dim < indices_length; dim++)
+        output_shape[batch_dims + dim] = indices_shape[batch_dims + dim];
+    for (int64_t dim = 0; dim < slice_length; dim++)
+        output_shape[batch_dims + indices_length + dim] = data_shape[batch_dims + tuple_length + dim];
+}
+}  // namespace gather_nd
+
+namespace v5 {
+
+// unlike v8, the batch dimensions are fused to the first dimension of the output
+template <class T>
+void shape_infer(const GatherND* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    gather_nd::shape_infer_base(op, input_shapes, output_shapes);
+
+    auto& output_shape = output_shapes[0];
+    const auto batch_dims = op->get_batch_dims();
+    if (batch_dims > 1 && output_shape.rank().is_static()) {
+        DimType batch = output_shape[0];
+        for (size_t dim = 1; dim < batch_dims; dim++)
+            batch *= output_shape[dim];
+        const auto fused_rank = output_shape.size() - batch_dims + 1;
+        output_shape[0] = batch;
+        for (size_t dim = 1; dim < fused_rank; dim++)
+            output_shape[dim] = output_shape[dim + batch_dims - 1];
+        output_shape.resize(fused_rank);
+    }
+}
+}  // namespace v5
+
+namespace v8 {
+
+template <class T>
+void shape_infer(const GatherND* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    gather_nd::shape_infer_base(op, input_shapes, output_shapes);
+}
+}  // namespace v8
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,177 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/avg_pool.hpp>
+#include <openvino/op/max_pool.hpp>
+
+#include "utils.hpp"
+namespace ov {
+namespace op {
+namespace pooling {
+
+/**
+ * @brief Infers the output shapes of the pooling and the pads actually applied to the spatial dimensions, which for
+ * the auto padding depend on the input shape. All the outputs have the shape of the pooled data.
+ */
+template <class OP, class T>
+void shape_infer(const OP* op,
+                 const Strides& dilations,
+                 bool is_window_all_in_padding_allowed,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && !output_shapes.empty());
+    const auto& data_shape = input_shapes[0];
+    const auto data_rank = data_shape.rank();
+    auto& output_shape = output_shapes[0];
+
+    NODE_VALIDATION_CHECK(op,
+                          data_rank.compatible(3) || data_rank.compatible(4) || data_rank.compatible(5),
+                          "Expected a 3D, 4D or 5D tensor for the input. Got: ",
+                          data_shape);
+
+    if (data_rank.is_dynamic()) {
+        pads_begin.clear();
+        pads_end.clear();
+        output_shape = ov::PartialShape::dynamic();
+    } else {
+        const auto spatial_rank = static_cast<size_t>(data_rank.get_length() - 2);
+        const auto& kernel = op->get_kernel();
+        const auto strides = op->get_strides().empty() ? Strides(spatial_rank, 1) : op->get_strides();
+        const auto window_dilations = dilations.empty() ? Strides(spatial_rank, 1) : dilations;
+        NODE_VALIDATION_CHECK(op,
+                              kernel.size() == spatial_rank,
+                              "Expected kernel size to be equal to input size - 2. Got: ",
+                              kernel.size());
+        NODE_VALIDATION_CHECK(op,
+                              strides.size() == spatial_rank,
+                              "Expected strides size to be equal to input size - 2. Got: ",
+                              strides.size());
+        NODE_VALIDATION_CHECK(op,
+                              window_dilations.size() == spatial_rank,
+                              "Expected dilations size to be equal to input size - 2. Got: ",
+                              window_dilations.size());
+
+        const auto auto_pad = op->get_auto_pad();
+        const bool is_same_pad = auto_pad == PadType::SAME_UPPER || auto_pad == PadType::SAME_LOWER;
+        const bool ceil_mode = op->get_rounding_type() == RoundingType::CEIL;
+        if (auto_pad == PadType::EXPLICIT) {
+            const auto& op_pads_begin = op->get_pads_begin();
+            const auto& op_pads_end = op->get_pads_end();
+            pads_begin = op_pads_begin.empty() ? CoordinateDiff(spatial_rank, 0)
+                                               : CoordinateDiff(op_pads_begin.begin(), op_pads_begin.end());
+            pads_end = op_pads_end.empty() ? CoordinateDiff(spatial_rank, 0)
+                                           : CoordinateDiff(op_pads_end.begin(), op_pads_end.end());
+            NODE_VALIDATION_CHECK(op,
+                                  pads_begin.size() == spatial_rank,
+                                  "Expected pads_begin size to be equal to input size - 2. Got: ",
+                                  pads_begin.size());
+            NODE_VALIDATION_CHECK(op,
+                                  pads_end.size() == spatial_rank,
+                                  "Expected pads_end size to be equal to input size - 2. Got: ",
+                                  pads_end.size());
+        } else {
+            // the auto pads are computed below per spatial dimension, VALID pads nothing
+            pads_begin = CoordinateDiff(spatial_rank, 0);
+            pads_end = CoordinateDiff(spatial_rank, 0);
+        }
+
+        output_shape.resize(spatial_rank + 2);
+        output_shape[0] = data_shape[0];
+        output_shape[1] = data_shape[1];
+        for (size_t i = 0; i < spatial_rank; ++i) {
+            const auto stride = static_cast<int64_t>(strides[i]);
+            const auto window = static_cast<int64_t>((kernel[i] - 1) * window_dilations[i] + 1);
+            NODE_VALIDATION_CHECK(op, stride > 0, "Window strides has zero dimension at axis ", i, ".");
+            NODE_VALIDATION_CHECK(op,
+                                  kernel[i] > 0 && window_dilations[i] > 0,
+                                  "Window after dilation has dimension less than 1 (dim: ",
+                                  window,
+                                  ") at axis ",
+                                  i,
+                                  ".");
+
+            const auto& data_dim = data_shape[i + 2];
+            if (data_dim.is_dynamic()) {
+                output_shape[i + 2] = Dimension::dynamic();
+                continue;
+            }
+            const auto data_size = static_cast<int64_t>(data_dim.get_length());
+            if (is_same_pad) {
+                const auto output_size = (data_size + stride - 1) / stride;
+                const auto padding_needed = std::max<int64_t>(0, (output_size - 1) * stride + window - data_size);
+                const auto padding_lhs = padding_needed / 2;
+                const auto padding_rhs = padding_needed - padding_lhs;
+                pads_begin[i] = auto_pad == PadType::SAME_UPPER ? padding_lhs : padding_rhs;
+                pads_end[i] = auto_pad == PadType::SAME_UPPER ? padding_rhs : padding_lhs;
+            }
+
+            NODE_VALIDATION_CHECK(op,
+                                  is_window_all_in_padding_allowed || (window > pads_begin[i] && window > pads_end[i]),
+                                  "Window after dilation is sometimes entirely in the padding area for axis ",
+                                  i,
+                                  " (dilated window dimension: ",
+                                  window,
+                                  ", padding below dimension: ",
+                                  pads_begin[i],
+                                  ", padding above dimension: ",
+                                  pads_end[i],
+                                  ") and this is not ",
+                                  "allowed.");
+            const auto padded_size = data_size + pads_begin[i] + pads_end[i];
+            NODE_VALIDATION_CHECK(op,
+                                  window <= padded_size,
+                                  "Window after dilation has dimension (dim: ",
+                                  window,
+                                  ") larger than the data shape after padding (dim: ",
+                                  padded_size,
+                                  ") at axis ",
+                                  i,
+                                  ".");
+
+            const auto windows = padded_size - window + (ceil_mode ? stride - 1 : 0);
+            output_shape[i + 2] = static_cast<size_t>(windows / stride + 1);
+        }
+    }
+
+    for (size_t i = 1; i < output_shapes.size(); ++i)
+        output_shapes[i] = output_shape;
+}
+}  // namespace pooling
+
+namespace v1 {
+
+template <class T>
+void shape_infer(const MaxPool* op,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes) {
+    pooling::shape_infer(op, Strides{}, true, pads_begin, pads_end, input_shapes, output_shapes);
+}
+
+template <class T>
+void shape_infer(const AvgPool* op,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes) {
+    pooling::shape_infer(op, Strides{}, !op->get_exclude_pad(), pads_begin, pads_end, input_shapes, output_shapes);
+}
+}  // namespace v1
+
+namespace v8 {
+
+template <class T>
+void shape_infer(const MaxPool* op,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes) {
+    pooling::shape_infer(op, op->get_dilations(), true, pads_begin, pads_end, input_shapes, output_shapes);
+}
+}  // namespace v8
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,164 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/gru_cell.hpp>
+#include <openvino/op/gru_sequence.hpp>
+#include <openvino/op/lstm_sequence.hpp>
+#include <openvino/op/rnn_cell.hpp>
+#include <openvino/op/rnn_sequence.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace rnn {
+
+// merges the dimension of the input to the dimension known so far, the static dimensions can't start as dynamic ones
+template <class DimType, class T>
+void merge_dim(const Node* op, DimType& merged, bool& is_known, const T& shape, size_t dim, const char* name) {
+    if (shape.rank().is_dynamic())
+        return;
+    if (!is_known) {
+        merged = shape[dim];
+        is_known = true;
+    } else {
+        NODE_VALIDATION_CHECK(op,
+                              DimType::merge(merged, merged, shape[dim]),
+                              "Parameter ",
+                              name,
+                              " not matched for the inputs of ",
+                              op->get_type_name(),
+                              ".");
+    }
+}
+
+template <class T>
+void check_rank(const Node* op, const T& shape, int64_t rank, size_t port) {
+    NODE_VALIDATION_CHECK(op,
+                          shape.rank().compatible(rank),
+                          op->get_type_name(),
+                          " input rank is not correct for ",
+                          port,
+                          " input parameter. Current rank: ",
+                          shape.rank(),
+                          ", expected: ",
+                          rank,
+                          ".");
+}
+
+/**
+ * @brief Infers the output shape [batch_size, hidden_size] of the GRU and RNN cells, the inputs are X, H, W, R and B
+ */
+template <class T>
+void cell_shape_infer(const util::RNNCellBase* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    enum { X, H, W, R, B };
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 5 && output_shapes.size() == 1);
+    check_rank(op, input_shapes[X], 2, X);
+    check_rank(op, input_shapes[H], 2, H);
+    check_rank(op, input_shapes[W], 2, W);
+    check_rank(op, input_shapes[R], 2, R);
+    check_rank(op, input_shapes[B], 1, B);
+
+    DimType batch_size, hidden_size;
+    bool is_batch_known = false, is_hidden_known = false;
+    merge_dim(op, batch_size, is_batch_known, input_shapes[X], 0, "batch_size");
+    merge_dim(op, batch_size, is_batch_known, input_shapes[H], 0, "batch_size");
+    merge_dim(op, hidden_size, is_hidden_known, input_shapes[H], 1, "hidden_size");
+    merge_dim(op, hidden_size, is_hidden_known, input_shapes[R], 1, "hidden_size");
+
+    auto& output_shape = output_shapes[0];
+    output_shape.resize(2);
+    output_shape[0] = is_batch_known ? batch_size : DimType(Dimension::dynamic());
+    output_shape[1] = is_hidden_known ? hidden_size : DimType(Dimension::dynamic());
+}
+
+/**
+ * @brief Infers the output shapes of the sequences: Y [batch_size, num_directions, seq_length, hidden_size] and the
+ * last states [batch_size, num_directions, hidden_size]. The inputs are X, the initial states, the sequence lengths, W,
+ * R and B.
+ */
+template <class OP, class T>
+void seq_shape_infer(const OP* op,
+                     const std::vector<T>& input_shapes,
+                     std::vector<T>& output_shapes,
+                     size_t states_count) {
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    const size_t X = 0, SEQ_LENGTHS = 1 + states_count, W = SEQ_LENGTHS + 1, R = W + 1, B = R + 1;
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == B + 1 && output_shapes.size() == 1 + states_count);
+    check_rank(op, input_shapes[X], 3, X);
+    for (size_t state = 1; state <= states_count; state++)
+        check_rank(op, input_shapes[state], 3, state);
+    check_rank(op, input_shapes[SEQ_LENGTHS], 1, SEQ_LENGTHS);
+    check_rank(op, input_shapes[W], 3, W);
+    check_rank(op, input_shapes[R], 3, R);
+    check_rank(op, input_shapes[B], 2, B);
+
+    DimType batch_size, hidden_size;
+    DimType num_directions = op->get_direction() == RecurrentSequenceDirection::BIDIRECTIONAL ? 2 : 1;
+    bool is_batch_known = false, is_hidden_known = false, is_directions_known = true;
+    merge_dim(op, batch_size, is_batch_known, input_shapes[X], 0, "batch_size");
+    merge_dim(op, batch_size, is_batch_known, input_shapes[SEQ_LENGTHS], 0, "batch_size");
+    for (size_t state = 1; state <= states_count; state++) {
+        merge_dim(op, batch_size, is_batch_known, input_shapes[state], 0, "batch_size");
+        merge_dim(op, num_directions, is_directions_known, input_shapes[state], 1, "num_directions");
+        merge_dim(op, hidden_size, is_hidden_known, input_shapes[state], 2, "hidden_size");
+    }
+    merge_dim(op, num_directions, is_directions_known, input_shapes[W], 0, "num_directions");
+    merge_dim(op, num_directions, is_directions_known, input_shapes[R], 0, "num_directions");
+    merge_dim(op, num_directions, is_directions_known, input_shapes[B], 0, "num_directions");
+    merge_dim(op, hidden_size, is_hidden_known, input_shapes[R], 2, "hidden_size");
+    if (!is_batch_known)
+        batch_size = Dimension::dynamic();
+    if (!is_hidden_known)
+        hidden_size = Dimension::dynamic();
+
+    auto& y_shape = output_shapes[0];
+    y_shape.resize(4);
+    y_shape[0] = batch_size;
+    y_shape[1] = num_directions;
+    y_shape[2] = input_shapes[X].rank().is_static() ? input_shapes[X][1] : DimType(Dimension::dynamic());
+    y_shape[3] = hidden_size;
+    for (size_t state = 1; state <= states_count; state++) {
+        auto& state_shape = output_shapes[state];
+        state_shape.resize(3);
+        state_shape[0] = batch_size;
+        state_shape[1] = num_directions;
+        state_shape[2] = hidden_size;
+    }
+}
+}  // namespace rnn
+
+namespace v0 {
+template <class T>
+void shape_infer(const RNNCell* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    rnn::cell_shape_infer(op, input_shapes, output_shapes);
+}
+}  // namespace v0
+
+namespace v3 {
+template <class T>
+void shape_infer(const GRUCell* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    rnn::cell_shape_infer(op, input_shapes, output_shapes);
+}
+}  // namespace v3
+
+namespace v5 {
+template <class T>
+void shape_infer(const RNNSequence* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    rnn::seq_shape_infer(op, input_shapes, output_shapes, 1);
+}
+
+template <class T>
+void shape_infer(const GRUSequence* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    rnn::seq_shape_infer(op, input_shapes, output_shapes, 1);
+}
+
+template <class T>
+void shape_infer(const LSTMSequence* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    rnn::seq_shape_infer(op, input_shapes, output_shapes, 2);
+}
+}  // namespace v5
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/roi_pooling.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v0 {
+
+template <class T>
+void shape_infer(const ROIPooling* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& feat_maps_shape = input_shapes[0];
+    const auto& coords_shape = input_shapes[1];
+    const auto& pooled_size = op->get_output_size();
+
+    NODE_VALIDATION_CHECK(op,
+                          feat_maps_shape.rank().compatible(4),
+                          "Expected a 4D tensor for the feature maps input. Got: ",
+                          feat_maps_shape);
+    NODE_VALIDATION_CHECK(op,
+                          coords_shape.rank().compatible(2),
+                          "Expected a 2D tensor for the ROIs input with box coordinates. Got: ",
+                          coords_shape);
+    NODE_VALIDATION_CHECK(op,
+                          pooled_size.size() == 2,
+                          "The dimension of pooled size is expected to be equal to 2. Got: ",
+                          pooled_size.size());
+    if (coords_shape.rank().is_static()) {
+        NODE_VALIDATION_CHECK(op,
+                              coords_shape[1].compatible(5),
+                              "The second dimension of ROIs input should contain batch id and box coordinates. ",
+                              "This dimension is expected to be equal to 5. Got: ",
+                              coords_shape[1]);
+    }
+
+    // the output shape is {NUM_ROIS, C, pooled_h, pooled_w}
+    auto& output_shape = output_shapes[0];
+    output_shape.resize(4);
+    output_shape[0] = coords_shape.rank().is_static() ? coords_shape[0] : Dimension::dynamic();
+    output_shape[1] = feat_maps_shape.rank().is_static() ? feat_maps_shape[1] : Dimension::dynamic();
+    output_shape[2] = pooled_size[0];
+    output_shape[3] = pooled_size[1];
+}
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <numeric>
+#include <openvino/op/slice.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace slice {
+
+inline int64_t get_sliced_dim_size(int64_t start, int64_t stop, int64_t step, int64_t dim_size) {
+    // normalize the negative indices and clip them by the dim size
+    start = start < 0 ? dim_size + start : start;
+    stop = stop < 0 ? dim_size + stop : stop;
+    start = std::max<int64_t>(0, std::min(start, dim_size));  // inclusive
+    stop = std::max<int64_t>(-1, std::min(stop, dim_size));   // exclusive
+
+    const auto elements_in_range = step < 0 ? std::max<int64_t>(0, std::min(dim_size - 1, start) - stop)
+                                            : std::max<int64_t>(0, stop - start);
+    return (elements_in_range + std::abs(step) - 1) / std::abs(step);
+}
+}  // namespace slice
+
+namespace v8 {
+
+/**
+ * @brief Infers the output shape of Slice from the values of start, stop, step and axes. The axes default to the first
+ * ones. The sliced dimensions of the partial shapes are dynamic unless the input dimension is static.
+ */
+template <class T>
+void shape_infer(const Slice* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    NODE_VALIDATION_CHECK(op, (input_shapes.size() == 4 || input_shapes.size() == 5) && output_shapes.size() == 1);
+    const auto& data_shape = input_shapes[0];
+    auto& output_shape = output_shapes[0];
+
+    NODE_VALIDATION_CHECK(op,
+                          data_shape.rank().is_dynamic() || data_shape.size() > 0,
+                          "Slice `data` input can't be a scalar.");
+    for (size_t port = 1; port < input_shapes.size(); port++) {
+        NODE_VALIDATION_CHECK(op,
+                              input_shapes[port].rank().compatible(1),
+                              "Slice `start`, `stop`, `step` and `axes` inputs must be 1D tensors.");
+    }
+
+    output_shape = data_shape;
+    if (data_shape.rank().is_dynamic())
+        return;
+
+    std::vector<int64_t> starts, stops, steps, axes;
+    if (!get_data_as_int64<T>(1, op, starts, constant_data) || !get_data_as_int64<T>(2, op, stops, constant_data) ||
+        !get_data_as_int64<T>(3, op, steps, constant_data)) {
+        output_shape = ov::PartialShape::dynamic(data_shape.rank());
+        return;
+    }
+    if (input_shapes.size() > 4) {
+        if (!get_data_as_int64<T>(4, op, axes, constant_data)) {
+            output_shape = ov::PartialShape::dynamic(data_shape.rank());
+            return;
+        }
+    } else {
+        axes.resize(starts.size());
+        std::iota(axes.begin(), axes.end(), 0);
+    }
+
+    NODE_VALIDATION_CHECK(op,
+                          stops.size() == starts.size() && steps.size() == starts.size() &&
+                              axes.size() == starts.size(),
+                          "Slice `start`, `stop`, `step`, `axes` inputs need to have the same size.");
+
+    const auto rank = static_cast<int64_t>(data_shape.size());
+    std::vector<bool> sliced(rank, false);
+    for (size_t i = 0; i < axes.size(); ++i) {
+        const auto axis = axes[i] < 0 ? rank + axes[i] : axes[i];
+        NODE_VALIDATION_CHECK(op,
+                              axis >= 0 && axis < rank,
+                              "Values in the `axes` input must be in range of the `data` input rank: [-",
+                              rank,
+                              ", ",
+                              rank - 1,
+                              "]. Got: ",
+                              axes[i]);
+        NODE_VALIDATION_CHECK(op, !sliced[axis], "Slice values in `axes` input must be unique.");
+        NODE_VALIDATION_CHECK(op, steps[i] != 0, "Slice 'step' value can't be zero.");
+        sliced[axis] = true;
+
+        const auto& dim = data_shape[axis];
+        if (dim.is_static()) {
+            output_shape[axis] = slice::get_sliced_dim_size(starts[i], stops[i], steps[i], dim.get_length());
+        } else {
+            output_shape[axis] = Dimension::dynamic();
+        }
+    }
+}
+}  // namespace v8
+}  // namespace op
+}  // namespace ov
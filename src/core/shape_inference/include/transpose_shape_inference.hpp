@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/transpose.hpp>
+
+#include "utils.hpp"
+namespace ov {
+namespace op {
+namespace v1 {
+
+template <class T>
+void shape_infer(const Transpose* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& arg_shape = input_shapes[0];
+    const auto& input_order_shape = input_shapes[1];
+    auto& output_shape = output_shapes[0];
+
+    NODE_VALIDATION_CHECK(op, input_order_shape.rank().compatible(1), "Input order must be a vector.");
+    const auto arg_rank = arg_shape.rank();
+    NODE_VALIDATION_CHECK(
+        op,
+        arg_rank.is_dynamic() || input_order_shape.rank().is_dynamic() ||
+            input_order_shape[0].compatible(arg_rank.get_length()) || input_order_shape[0] == 0,
+        "Input order must have shape [n], where n is the rank of arg.");
+
+    std::vector<int64_t> permutation;
+    if (get_data_as_int64<T>(1, op, permutation, constant_data)) {
+        // the empty order reverses the axes
+        if (permutation.empty() && arg_rank.is_static()) {
+            for (int64_t i = 1; i <= arg_rank.get_length(); ++i)
+                permutation.push_back(arg_rank.get_length() - i);
+        }
+        const auto rank = static_cast<int64_t>(permutation.size());
+        std::vector<bool> used(rank, false);
+        bool is_valid = arg_rank.is_dynamic() || arg_rank.get_length() == rank;
+        for (size_t i = 0; is_valid && i < permutation.size(); ++i) {
+            const auto axis = permutation[i];
+            is_valid = axis >= 0 && axis < rank && !used[axis];
+            if (is_valid)
+                used[axis] = true;
+        }
+        NODE_VALIDATION_CHECK(op,
+                              is_valid,
+                              "Permutation ",
+                              ov::AxisVector(permutation.begin(), permutation.end()),
+                              " is not valid for input shape ",
+                              arg_shape);
+
+        if (arg_rank.is_static()) {
+            output_shape.resize(rank);
+            for (int64_t i = 0; i < rank; ++i)
+                output_shape[i] = arg_shape[permutation[i]];
+        } else {
+            output_shape = ov::PartialShape::dynamic();
+        }
+    } else {
+        Rank output_rank = arg_rank;
+        if (output_rank.is_dynamic() && input_order_shape.is_static() && input_order_shape[0].get_length())
+            output_rank = Rank(input_order_shape[0].get_length());
+        output_shape = ov::PartialShape::dynamic(output_rank);
+    }
+}
+}  // namespace v1
+}  // namespace op
+}  // namespace ov
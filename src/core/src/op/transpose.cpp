@@ -5,6 +5,7 @@
 #include "ngraph/op/transpose.hpp"
 
 #include <ngraph/validation_util.hpp>
+#include <transpose_shape_inference.hpp>
 
 #include "itt.hpp"
 #include "ngraph/runtime/reference/transpose.hpp"
@@ -30,39 +31,12 @@ void op::v1::Transpose::validate_and_infer_types() {
                           input_order_et.is_dynamic() || input_order_et.is_integral_number(),
                           "Input order must have an integral number element type.");
 
-    const auto& input_order_shape = get_input_partial_shape(1);
-    NODE_VALIDATION_CHECK(this, input_order_shape.rank().compatible(1), "Input order must be a vector.");
-
-    const auto& arg_shape = get_input_partial_shape(0);
-    NODE_VALIDATION_CHECK(
-        this,
-        input_order_shape.compatible(ov::PartialShape{arg_shape.rank()}) ||
-            (input_order_shape.is_static() && input_order_shape.rank() == 1 && input_order_shape[0] == 0),
-        "Input order must have shape [n], where n is the rank of arg.");
-
     set_input_is_relevant_to_shape(1);
 
-    NGRAPH_SUPPRESS_DEPRECATED_START
-    if (const auto& input_const = get_constant_from_source(input_value(1))) {
-        auto permutation = input_const->get_axis_vector_val();
-        if (permutation.empty()) {
-            for (int64_t i = 1; i <= arg_shape.rank().get_length(); ++i)
-                permutation.emplace_back(arg_shape.rank().get_length() - i);
-        }
-        NODE_VALIDATION_CHECK(this,
-                              is_valid_permutation(permutation, arg_shape.rank()),
-                              "Permutation ",
-                              permutation,
-                              " is not valid for input shape ",
-                              arg_shape);
-        set_output_type(0, get_input_element_type(0), ngraph::apply_permutation(arg_shape, permutation));
-    } else {
-        Rank output_rank = arg_shape.rank();
-        if (output_rank.is_dynamic() && input_order_shape.is_static() && input_order_shape[0].get_length())
-            output_rank = input_order_shape[0];
-        set_output_type(0, get_input_element_type(0), ov::PartialShape::dynamic(output_rank));
-    }
-    NGRAPH_SUPPRESS_DEPRECATED_END
+    std::vector<ov::PartialShape> output_shapes = {ov::PartialShape{}};
+    std::vector<ov::PartialShape> input_shapes = {get_input_partial_shape(0), get_input_partial_shape(1)};
+    shape_infer(this, input_shapes, output_shapes);
+    set_output_type(0, get_input_element_type(0), output_shapes[0]);
 }
 
 shared_ptr<Node> op::v1::Transpose::clone_with_new_inputs(const OutputVector& new_args) const {
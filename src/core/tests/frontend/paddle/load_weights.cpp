@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <fstream>
+#include <frontend/shared/include/utils.hpp>
+#include <iterator>
+#include <map>
+#include <openvino/frontend/exception.hpp>
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <sstream>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "paddle_utils.hpp"
+
+using namespace ov::frontend;
+
+namespace {
+// batch_norm_nchw is saved both with the combined parameters file and with the file per parameter
+const std::string model_dir = std::string(TEST_PADDLE_MODELS_DIRNAME) + "batch_norm_nchw";
+const std::map<std::string, std::vector<float>> model_weights = {
+    {"scale1", {1.0f, 1.5f}},
+    {"bias1", {0.0f, 1.0f}},
+    {"bn_mean1", {0.0f, 3.0f}},
+    {"bn_variance1", {1.0f, 1.5f}},
+};
+
+std::map<std::string, std::vector<float>> get_weights(const std::shared_ptr<ov::Model>& model) {
+    std::map<std::string, std::vector<float>> weights;
+    for (const auto& op : model->get_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(op))
+            weights[constant->get_friendly_name()] = constant->cast_vector<float>();
+    }
+    return weights;
+}
+
+std::shared_ptr<ov::Model> convert(const std::string& path) {
+    FrontEndTestUtils::setupTestEnv();
+    FrontEndManager fem;
+    auto frontend = fem.load_by_framework(PADDLE_FE);
+    return frontend->convert(frontend->load(path));
+}
+
+std::string read_file(const std::string& path) {
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+void write_file(const std::string& path, const std::string& content) {
+    std::ofstream stream(path, std::ios::out | std::ios::binary);
+    stream << content;
+}
+
+std::string get_unique_name() {
+    std::stringstream ss;
+    ss << "paddle_" << ::testing::UnitTest::GetInstance()->current_test_info()->name() << "_"
+       << std::this_thread::get_id() << "_" << std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    return ss.str();
+}
+}  // namespace
+
+TEST(Paddle_LoadWeights, combined_params_file) {
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = convert(FrontEndTestUtils::make_model_path(model_dir + "/batch_norm_nchw.pdmodel")));
+    ASSERT_NE(model, nullptr);
+    EXPECT_EQ(get_weights(model), model_weights);
+}
+
+TEST(Paddle_LoadWeights, combined_params_stream) {
+    FrontEndTestUtils::setupTestEnv();
+    std::ifstream model_stream(FrontEndTestUtils::make_model_path(model_dir + "/batch_norm_nchw.pdmodel"),
+                               std::ios::in | std::ios::binary);
+    std::ifstream weights_stream(FrontEndTestUtils::make_model_path(model_dir + "/batch_norm_nchw.pdiparams"),
+                                 std::ios::in | std::ios::binary);
+    std::istream* model_is(&model_stream);
+    std::istream* weights_is(&weights_stream);
+    FrontEndManager fem;
+    auto frontend = fem.load_by_framework(PADDLE_FE);
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = frontend->convert(frontend->load(model_is, weights_is)));
+    ASSERT_NE(model, nullptr);
+    EXPECT_EQ(get_weights(model), model_weights);
+}
+
+TEST(Paddle_LoadWeights, file_per_param) {
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = convert(FrontEndTestUtils::make_model_path(model_dir)));
+    ASSERT_NE(model, nullptr);
+    EXPECT_EQ(get_weights(model), model_weights);
+}
+
+TEST(Paddle_LoadWeights, truncated_combined_params_file) {
+    const auto name = get_unique_name();
+    const auto model = read_file(FrontEndTestUtils::make_model_path(model_dir + "/batch_norm_nchw.pdmodel"));
+    const auto params = read_file(FrontEndTestUtils::make_model_path(model_dir + "/batch_norm_nchw.pdiparams"));
+    ASSERT_FALSE(params.empty());
+    write_file(name + ".pdmodel", model);
+    // the last record misses the part of its data
+    write_file(name + ".pdiparams", params.substr(0, params.size() - sizeof(float)));
+
+    EXPECT_THROW(convert(name + ".pdmodel"), GeneralFailure);
+    CommonTestUtils::removeFile(name + ".pdmodel");
+    CommonTestUtils::removeFile(name + ".pdiparams");
+}
+
+TEST(Paddle_LoadWeights, truncated_param_file) {
+    const auto name = get_unique_name();
+    ASSERT_EQ(CommonTestUtils::createDirectory(name), 0);
+    const std::vector<std::string> files = {"__model__", "scale1", "bias1", "bn_mean1", "bn_variance1"};
+    for (const auto& file : files)
+        write_file(name + "/" + file, read_file(FrontEndTestUtils::make_model_path(model_dir + "/" + file)));
+    // the header is kept and the data is cut
+    const auto param = read_file(name + "/bn_mean1");
+    ASSERT_GT(param.size(), sizeof(float));
+    write_file(name + "/bn_mean1", param.substr(0, param.size() - sizeof(float)));
+
+    EXPECT_THROW(convert(name), GeneralFailure);
+    for (const auto& file : files)
+        CommonTestUtils::removeFile(name + "/" + file);
+    CommonTestUtils::removeDir(name);
+}
+
+TEST(Paddle_LoadWeights, missing_param_file) {
+    const auto name = get_unique_name();
+    ASSERT_EQ(CommonTestUtils::createDirectory(name), 0);
+    write_file(name + "/__model__", read_file(FrontEndTestUtils::make_model_path(model_dir + "/__model__")));
+
+    EXPECT_THROW(convert(name), GeneralFailure);
+    CommonTestUtils::removeFile(name + "/__model__");
+    CommonTestUtils::removeDir(name);
+}
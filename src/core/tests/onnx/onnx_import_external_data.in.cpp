@@ -84,6 +84,24 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file_mapped_once) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::map<std::string, std::shared_ptr<default_opset::Constant>> constants;
+    for (const auto& op : function->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<default_opset::Constant>(op))
+            constants[constant->get_friendly_name()] = constant;
+    }
+    ASSERT_EQ(constants.count("data_a"), 1);
+    ASSERT_EQ(constants.count("data_b"), 1);
+    // both constants point to the single mapping of the file at the offsets of the tensors
+    EXPECT_EQ(constants["data_b"]->get_data_ptr<char>() - constants["data_a"]->get_data_ptr<char>(), 4096);
+    EXPECT_EQ(constants["data_a"]->cast_vector<int32_t>(), (std::vector<int32_t>{3, 2, 1}));
+    EXPECT_EQ(constants["data_b"]->cast_vector<int32_t>(), (std::vector<int32_t>{1, 2, 3}));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_object.hpp"
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+
+namespace {
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> make_buffer(const std::shared_ptr<ov::util::MappedMemory>& mapped) {
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(mapped->data(),
+                                                                                                   mapped->size(),
+                                                                                                   mapped);
+}
+
+}  // namespace
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
+    try {
+        return make_buffer(ov::util::load_mmap_object(path));
+    } catch (const std::runtime_error& e) {
+        throw ov::Exception(e.what());
+    }
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path) {
+    try {
+        return make_buffer(ov::util::load_mmap_object(path));
+    } catch (const std::runtime_error& e) {
+        throw ov::Exception(e.what());
+    }
+}
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace ov
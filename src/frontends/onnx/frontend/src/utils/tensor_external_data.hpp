@@ -6,9 +6,23 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  The external data files mapped into memory by the full path,
+///         shared by the tensors of the model so each file is mapped once
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+
+/// \brief  The tensor data in the memory mapped external data file, keeps the mapping alive
+using ExternalDataBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -16,12 +30,14 @@ public:
 
     /// \brief      Load external data from tensor passed to constructor
     ///
-    /// \note       If read data from external file fails,
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
     ///
-    /// \return     External binary data loaded into a std::string
-    std::string load_external_data() const;
+    /// \param      cache  The files already mapped for the other tensors of the model, if null the file
+    ///                    is mapped for this tensor only
+    ///
+    /// \return     The buffer pointing to the tensor data in the memory mapped file
+    std::shared_ptr<ExternalDataBuffer> load_external_data(const MappedMemoryHandles& cache = {}) const;
 
     /// \brief      Represets parameter of external data as string
     ///
@@ -30,8 +46,8 @@ public:
 
 private:
     std::string m_data_location{};
-    int m_offset = 0;
-    int m_data_length = 0;
+    uint64_t m_offset = 0;
+    uint64_t m_data_length = 0;
     int m_sha1_digest = 0;
 };
 }  // namespace detail
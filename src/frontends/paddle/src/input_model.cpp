@@ -4,15 +4,21 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <future>
 #include <queue>
+#include <thread>
 
 #include "decoder_proto.hpp"
 #include "framework.pb.h"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
 
@@ -60,6 +66,7 @@ private:
     void loadPlaces();
     template <typename T>
     void loadConsts(const std::basic_string<T>& folder_with_weights, std::istream* weight_stream);
+    void loadMappedConsts(const std::shared_ptr<ov::util::MappedMemory>& weights);
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
 
     std::vector<std::shared_ptr<OpPlace>> m_op_places;
@@ -151,6 +158,64 @@ void InputModel::InputModelImpl::loadPlaces() {
 }
 
 namespace {
+struct ConstDesc {
+    std::string name;
+    element::Type type;
+    Shape shape;
+};
+
+// the persistable variables in the order of their records in the combined parameters file
+std::vector<ConstDesc> get_const_descs(const std::map<std::string, std::shared_ptr<TensorPlace>>& var_places) {
+    std::vector<ConstDesc> descs;
+    for (const auto& item : var_places) {
+        const auto& var_desc = item.second->get_desc();
+        const auto& name = item.first;
+        if (ov::util::ends_with(name, std::string{"feed"}) || ov::util::ends_with(name, std::string{"fetch"}))
+            continue;
+        if (!var_desc.persistable())
+            continue;
+
+        FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
+        const auto& tensor = var_desc.type().lod_tensor().tensor();
+        descs.push_back({name, TYPE_MAP[tensor.data_type()], Shape(tensor.dims().cbegin(), tensor.dims().cend())});
+    }
+    return descs;
+}
+
+// The tensor record: 16 bytes of the version and the LoD info, the size of the tensor description,
+// the description itself and the data. Returns the offset of the data in the mapped file.
+size_t get_mapped_tensor_data_offset(const std::shared_ptr<ov::util::MappedMemory>& mapped,
+                                     size_t offset,
+                                     size_t data_length,
+                                     const std::string& name) {
+    const size_t header_length = 16;
+    uint32_t dims_len = 0;
+    FRONT_END_GENERAL_CHECK(offset + header_length + sizeof(dims_len) <= mapped->size(),
+                            "File containing constant with name ",
+                            name,
+                            " wasn't successfully read.");
+    std::memcpy(&dims_len, mapped->data() + offset + header_length, sizeof(dims_len));
+    const size_t data_offset = offset + header_length + sizeof(dims_len) + dims_len;
+    FRONT_END_GENERAL_CHECK(data_offset + data_length <= mapped->size(),
+                            "File containing constant with name ",
+                            name,
+                            " wasn't successfully read.");
+    return data_offset;
+}
+
+// the constant aliases the mapped file, no copy of the data is made
+std::shared_ptr<opset7::Constant> make_mapped_constant(const std::shared_ptr<ov::util::MappedMemory>& mapped,
+                                                       size_t data_offset,
+                                                       const ConstDesc& desc) {
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        mapped->data() + data_offset,
+        shape_size(desc.shape) * desc.type.size(),
+        mapped);
+    auto const_node = std::make_shared<opset7::Constant>(desc.type, desc.shape, buffer);
+    const_node->set_friendly_name(desc.name);
+    return const_node;
+}
+
 bool read_tensor(std::istream& is, char* data, size_t len) {
     std::vector<char> header(16);
     is.read(&header[0], 16);
@@ -179,16 +244,14 @@ std::basic_string<wchar_t> get_const_path(const std::basic_string<wchar_t>& fold
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_path) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::string params_ext = ".pdiparams";
         std::string weights_file{path};
         weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_path = weights_file;
     } else {
         model_file += paddle::get_path_sep<T>() + "__model__";
     }
@@ -197,16 +260,15 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path,
+                                          std::basic_string<wchar_t>* weights_path) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
         std::wstring weights_file{path};
         weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_path = weights_file;
     } else {
         model_file += paddle::get_path_sep<wchar_t>() + L"__model__";
     }
@@ -264,39 +326,66 @@ std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::determine_cut_
 template <typename T>
 void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
                                             std::istream* weight_stream) {
-    for (const auto& item : m_var_places) {
-        const auto& var_desc = item.second->get_desc();
-        const auto& name = item.first;
-        if (ov::util::ends_with(name, std::string{"feed"}) || ov::util::ends_with(name, std::string{"fetch"}))
-            continue;
-        if (!var_desc.persistable())
-            continue;
-
-        FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
-        const auto& tensor = var_desc.type().lod_tensor().tensor();
-        Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
-        const auto& type = TYPE_MAP[tensor.data_type()];
-        const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
-
-        bool read_succeed = false;
-        if (weight_stream) {
-            read_succeed = read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else if (!folder_with_weights.empty()) {
-            std::ifstream is(get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
-            FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
-            read_succeed = read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else {
-            FRONT_END_GENERAL_CHECK(false, "Either folder with weights or stream must be provided.");
+    const auto descs = get_const_descs(m_var_places);
+    if (weight_stream) {
+        for (const auto& desc : descs) {
+            // the data is read right into the constant to avoid the intermediate copy
+            auto const_node = std::make_shared<opset7::Constant>(desc.type, desc.shape);
+            const auto data_length = shape_size(desc.shape) * desc.type.size();
+            auto data = static_cast<char*>(const_cast<void*>(const_node->get_data_ptr()));
+            FRONT_END_GENERAL_CHECK(read_tensor(*weight_stream, data, data_length),
+                                    "File containing constant with name ",
+                                    desc.name,
+                                    " wasn't successfully read.");
+            const_node->set_friendly_name(desc.name);
+            m_tensor_values[desc.name] = const_node;
+        }
+        return;
+    }
+    FRONT_END_GENERAL_CHECK(descs.empty() || !folder_with_weights.empty(),
+                            "Either folder with weights or stream must be provided.");
+
+    // one file per parameter: the files are mapped and their headers are parsed in parallel
+    std::vector<std::shared_ptr<opset7::Constant>> const_nodes(descs.size());
+    auto load_range = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const auto& desc = descs[i];
+            std::shared_ptr<ov::util::MappedMemory> mapped;
+            try {
+                mapped = ov::util::load_mmap_object(get_const_path(folder_with_weights, desc.name));
+            } catch (const std::runtime_error&) {
+                FRONT_END_GENERAL_CHECK(false, "Cannot open file for constant value.");
+            }
+            const auto data_length = shape_size(desc.shape) * desc.type.size();
+            const_nodes[i] =
+                make_mapped_constant(mapped, get_mapped_tensor_data_offset(mapped, 0, data_length, desc.name), desc);
         }
-        FRONT_END_GENERAL_CHECK(read_succeed,
-                                "File containing constant with name ",
-                                name,
-                                " wasn't successfully read.");
-
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
-        const_node->set_friendly_name(name);
-        m_tensor_values[name] = const_node;
+    };
+    const size_t num_threads =
+        std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), std::max<size_t>(descs.size(), 1));
+    std::vector<std::future<void>> futures;
+    for (size_t t = 1; t < num_threads; t++) {
+        futures.push_back(std::async(std::launch::async,
+                                     load_range,
+                                     descs.size() * t / num_threads,
+                                     descs.size() * (t + 1) / num_threads));
+    }
+    load_range(0, descs.size() / num_threads);
+    for (auto& future : futures)
+        future.get();
+
+    for (size_t i = 0; i < descs.size(); i++)
+        m_tensor_values[descs[i].name] = const_nodes[i];
+}
+
+void InputModel::InputModelImpl::loadMappedConsts(const std::shared_ptr<ov::util::MappedMemory>& weights) {
+    // the records of the combined file are sequential, so only the headers are visited to find the data offsets
+    size_t offset = 0;
+    for (const auto& desc : get_const_descs(m_var_places)) {
+        const auto data_length = shape_size(desc.shape) * desc.type.size();
+        const auto data_offset = get_mapped_tensor_data_offset(weights, offset, data_length, desc.name);
+        m_tensor_values[desc.name] = make_mapped_constant(weights, data_offset, desc);
+        offset = data_offset + data_length;
     }
 }
 
@@ -308,8 +397,8 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
       m_input_model(input_model),
       m_telemetry(telemetry) {
     std::string empty_str;
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(get_model_path<T>(path, &weights_stream), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_path;
+    std::ifstream pb_stream(get_model_path<T>(path, &weights_path), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -322,6 +411,23 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         version >= 2000000 || version == 0,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
+    if (!weights_path.empty()) {
+        std::shared_ptr<ov::util::MappedMemory> weights;
+        try {
+            weights = ov::util::load_mmap_object(weights_path);
+        } catch (const std::runtime_error&) {
+            // the file may be empty or missing, it is handled by the stream reading below
+        }
+        if (weights) {
+            loadMappedConsts(weights);
+            return;
+        }
+    }
+    std::ifstream weights_stream;
+    if (!weights_path.empty())
+        weights_stream.open(weights_path, std::ios::binary);
+    // Don't throw error if file isn't opened
+    // It may mean that model don't have constants
     if (weights_stream && weights_stream.is_open()) {
         loadConsts(std::basic_string<T>{}, &weights_stream);
     } else {
@@ -46,6 +46,13 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Number of the polling attempts of an idle CPU Executor Stream thread before it falls asleep.
+ * Spinning reduces the latency of the tasks submission at the cost of the CPU time
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_THREADS_SPIN_COUNT);
+
 /**
  * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type per
  * stream
@@ -53,6 +60,98 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines the scope of the CPU runtime parameters cache: STREAM (each stream has its own cache),
+ * NETWORK (a single thread safe cache is shared by all the streams of an executable network) or
+ * PROCESS (a single cache is shared by all the executable networks of the process)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARING);
+DECLARE_CONFIG_VALUE(STREAM);
+DECLARE_CONFIG_VALUE(NETWORK);
+DECLARE_CONFIG_VALUE(PROCESS);
+
+/**
+ * @brief Metric to get the hit/miss/eviction counters of the CPU runtime parameters cache of an executable network.
+ * The hits and misses are the lookups of the network only. With the PROCESS sharing the evictions of the cache shared
+ * by the process are not reported, as they can't be attributed to a network
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_RUNTIME_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Enables concurrent execution of independent graph branches inside the thread budget of a single CPU stream
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLELISM);
+
+/**
+ * @brief Enables packing of the CPU graph edges with dynamic shapes into a single monotonically growing workspace
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_MEMORY_ARENA);
+
+/**
+ * @brief Enables persistent storage of the repacked CPU weights in the CACHE_DIR, so the weights reorders are not
+ * repeated on the next network loading
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PERSISTENT_WEIGHTS_CACHE);
+
+/**
+ * @brief Metric to get the number of the repacked weights entries an executable network restored from the persistent
+ * weights cache (restored) and wrote to it (stored)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_PERSISTENT_WEIGHTS_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Enables export of the implementations and the memory formats selected for the nodes of the compiled CPU graph,
+ * so the imported network creates its graph with the same selection
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_EXPORT_COMPILED_GRAPH);
+
+/**
+ * @brief Enables the tokenization of the nodes with dynamic shapes into the CPU snippets: NO (default) or YES.
+ * The snippet kernels of the dynamic nodes are generated for each new input shape at runtime and cached
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SNIPPETS);
+
+/**
+ * @brief Metric to get the number of the CPU graphs workspaces pages located on the NUMA node of the owning stream
+ * (local_pages), on the other nodes (remote_pages) and not yet allocated or not queryable (unknown_pages)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_METRIC_KEY(CPU_NUMA_MEMORY_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Backs the CPU graph workspace and the repacked constant weights with 2 MB huge pages: NO (default),
+ * TRANSPARENT (transparent huge pages requested via madvise) or EXPLICIT (MAP_HUGETLB pool, falls back to
+ * the transparent ones). The ordinary pages are used if the huge pages are not available.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+DECLARE_CONFIG_VALUE(TRANSPARENT);
+DECLARE_CONFIG_VALUE(EXPLICIT);
+
+/**
+ * @brief Enables binding of the output tensors of the dynamic shapes CPU graph nodes directly to the memory of
+ * the output blobs, so the result is not copied after the inference. The blobs grow through their own allocators.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_ZERO_COPY_OUTPUTS);
+
+/**
+ * @brief Maximal number of the graphs per stream created on the fly for the static input shapes other than the model
+ * ones. The graphs reuse the transformed model, the primitives selection and the repacked weights of the original graph.
+ * Zero (default) disables the input shapes change for the static models. It's also disabled for the models with ShapeOf
+ * and for the imported ones, since their shape subgraphs are folded.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_VARIANTS);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
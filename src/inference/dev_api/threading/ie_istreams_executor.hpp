@@ -103,6 +103,8 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        int _threadSpinCount = 0;  //!< Number of the polling attempts of an idle stream thread before it is parked
+                                   //!< waiting for a new task. Zero means parking immediately
 
         /**
          * @brief      A constructor with arguments
@@ -34,5 +34,25 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for the pipelined execution of the subgraphs by the asynchronous infer requests.
+ * It's the maximal number of the requests executed by one subgraph at the same time, the next requests wait in the FIFO
+ * queue of the subgraph, while the previous ones go on with the next subgraphs, so the subgraph k of one request
+ * overlaps with the subgraph k + 1 of the previous one. The intermediate blobs are passed between the subgraphs
+ * without copying. This option should be used with the non negative integer values, 0 (default) means no limit.
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS);
+
 }  // namespace HeteroConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get the utilization of the subgraphs of the executable network by the asynchronous infer requests:
+ * the part of the time since the first request of the subgraph when the subgraph was executing at least one request.
+ * The keys are "subgraph<index>: <device name>"
+ */
+DECLARE_METRIC_KEY(HETERO_PIPELINE_STAGES_UTILIZATION, std::map<std::string, float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
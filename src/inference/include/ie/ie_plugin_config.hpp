@@ -141,6 +141,22 @@ DECLARE_METRIC_KEY(OPTIMAL_BATCH_SIZE, unsigned int);
  */
 DECLARE_METRIC_KEY(MAX_BATCH_SIZE, unsigned int);
 
+/**
+ * @brief Metric of the Auto-Batching executable network to get the current timeout (in ms) to collect the batch.
+ *
+ * Metric returns a value of unsigned int type. In the adaptive mode (AUTO_BATCH_LATENCY_SLO is set) the value is chosen
+ * online from the arrival rate of the requests and the measured latencies, otherwise it is the AUTO_BATCH_TIMEOUT.
+ */
+DECLARE_METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT, unsigned int);
+
+/**
+ * @brief Metric of the Auto-Batching executable network to get the current effective batch size.
+ *
+ * Metric returns a value of unsigned int type: either the batch size of the device network, or 1 when the requests are
+ * executed by the non-batched network without waiting for the batch (as the batch can not meet AUTO_BATCH_LATENCY_SLO).
+ */
+DECLARE_METRIC_KEY(AUTO_BATCH_EFFECTIVE_BATCH_SIZE, unsigned int);
+
 /**
  * @brief Metric to provide a hint for a range for number of async infer requests. If device supports streams,
  * the metric provides range for number of IRs per stream.
@@ -294,6 +310,18 @@ DECLARE_CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG);
  * @brief Auto-batching configuration: string with timeout (in ms), e.g. "100"
  */
 DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+/**
+ * @brief Auto-batching configuration: string with the latency target (in ms) of the adaptive mode, e.g. "30".
+ * The timeout to collect the batch is chosen online (not exceeding the AUTO_BATCH_TIMEOUT) so that the waiting plus
+ * the batched execution meets the target, "0" (default) disables the adaptive mode
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LATENCY_SLO);
+/**
+ * @brief Auto-batching configuration: YES/NO to compile the networks for the power of 2 batch sizes below the full one,
+ * so the requests collected by the timeout are executed as the largest fitting partial batches rather than one by one,
+ * "NO" by default
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES);
 
 /**
  * @brief Limit `#threads` that are used by Inference Engine for inference on the CPU.
@@ -9,13 +9,18 @@
  */
 #pragma once
 
+#include <atomic>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <random>
 #include <string>
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "ie_common.h"
+#include "openvino/util/mmap_object.hpp"
 
 namespace InferenceEngine {
 
@@ -85,6 +90,13 @@ class FileStorageCacheManager final : public ICacheManager {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    static std::string getTmpFile(const std::string& blobFileName) {
+        // the random tag tells the processes apart and the counter the writers of the process
+        static const auto processTag = std::random_device{}();
+        static std::atomic<uint64_t> counter{0};
+        return blobFileName + "." + std::to_string(processTag) + "." + std::to_string(counter++) + ".tmp";
+    }
+
 public:
     /**
      * @brief Constructor
@@ -100,15 +112,47 @@ public:
 
 private:
     void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        // The entry is written aside and then replaces the old one, so the old file is never truncated under
+        // the readers which have it mapped. Each writer has the temporary file of its own, the threads and the
+        // processes sharing the cache directory may write the same entry at the same time
+        auto blobFileName = getBlobFile(id);
+        auto tmpFileName = getTmpFile(blobFileName);
+        {
+            std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+            if (!stream.is_open())
+                IE_THROW() << "Failed to create the cache file " << tmpFileName;
+            try {
+                writer(stream);
+                stream.flush();
+                if (!stream.good())
+                    IE_THROW() << "Failed to write the cache file " << tmpFileName;
+            } catch (...) {
+                stream.close();
+                std::remove(tmpFileName.c_str());
+                throw;
+            }
+        }
+        if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+            // rename doesn't replace the existing file on some platforms
+            std::remove(blobFileName.c_str());
+            if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+                std::remove(tmpFileName.c_str());
+                IE_THROW() << "Failed to replace the cache file " << blobFileName;
+            }
+        }
     }
 
     void readCacheEntry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            // The mapped stream lets the plugins alias the cached data (e.g. the weights) instead of reading it
+            std::unique_ptr<std::ifstream> stream;
+            try {
+                stream.reset(new ov::util::MmapStream(blobFileName));
+            } catch (const std::runtime_error&) {
+                stream.reset(new std::ifstream(blobFileName, std::ios_base::binary));
+            }
+            reader(*stream);
         }
     }
 
@@ -25,6 +25,99 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer FIFO queue (D. Vyukov's algorithm).
+ * Each stream thread owns one queue, other threads put the tasks into it and steal the tasks from it.
+ */
+class TaskQueue {
+public:
+    explicit TaskQueue(std::size_t capacity) : _cells(capacity), _mask(capacity - 1) {
+        assert((capacity & _mask) == 0 && "capacity must be a power of 2");
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Moves the task into the queue
+     * @return false if the queue is full, the task is left untouched in this case
+     */
+    bool TryPush(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_task = std::move(task);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Takes the oldest task from the queue
+     * @return false if the queue is empty
+     */
+    bool TryPop(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        task = std::move(cell->_task);
+        cell->_task = nullptr;
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        Task _task;
+    };
+
+    static constexpr std::size_t cacheLineSize = 64;
+
+    std::vector<Cell> _cells;
+    const std::size_t _mask;
+    // the producers and consumers positions are kept in the different cache lines
+    char _pad0[cacheLineSize];
+    std::atomic<std::size_t> _enqueuePos{0};
+    char _pad1[cacheLineSize];
+    std::atomic<std::size_t> _dequeuePos{0};
+    char _pad2[cacheLineSize];
+};
+
+// the executor and the queue owned by the current thread, if it is a stream thread
+struct StreamThreadInfo {
+    const void* _executor = nullptr;
+    std::size_t _queueIdx = 0;
+};
+thread_local StreamThreadInfo streamThreadInfo;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -215,35 +308,108 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue{taskQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                streamThreadInfo._executor = this;
+                streamThreadInfo._queueIdx = static_cast<std::size_t>(streamId);
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    if (!WaitTask(streamId, task)) {
+                        break;
                     }
+                    Execute(task, *(_streams.local()));
                 }
             });
         }
     }
 
+    /**
+     * @brief Takes a task from the own queue of the stream thread, from the overflow queue or steals it
+     * from the other streams queues
+     */
+    bool TryPopTask(std::size_t queueIdx, Task& task) {
+        if (_taskQueues[queueIdx]->TryPop(task)) {
+            return true;
+        }
+        if (_overflowSize.load(std::memory_order_acquire) != 0) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _overflowSize.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+        }
+        for (std::size_t i = 1; i < _taskQueues.size(); ++i) {
+            if (_taskQueues[(queueIdx + i) % _taskQueues.size()]->TryPop(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Spins for a while, then parks the stream thread until a task is available
+     * @return false if the executor is stopped and there are no tasks left
+     */
+    bool WaitTask(std::size_t queueIdx, Task& task) {
+        if (TryPopTask(queueIdx, task)) {
+            return true;
+        }
+        for (int i = 0; i < _config._threadSpinCount; ++i) {
+            std::this_thread::yield();
+            if (TryPopTask(queueIdx, task)) {
+                return true;
+            }
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;) {
+            _parkedThreads.fetch_add(1, std::memory_order_seq_cst);
+            // pairs with the fence in Enqueue: either the producer sees the parked thread or the task is seen here
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (TryPopTask(queueIdx, task)) {
+                _parkedThreads.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            if (_isStopped) {
+                _parkedThreads.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+            _queueCondVar.wait(lock, [&] {
+                return _wakeups > 0 || _isStopped;
+            });
+            if (_wakeups > 0) {
+                --_wakeups;
+            }
+            _parkedThreads.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
     void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
+        // the stream thread puts the tasks into the own queue for the better locality,
+        // the other threads distribute them among the streams in the round-robin fashion
+        const auto queueIdx = streamThreadInfo._executor == this
+                                  ? streamThreadInfo._queueIdx
+                                  : _nextQueueIdx.fetch_add(1, std::memory_order_relaxed) % _taskQueues.size();
+        if (!_taskQueues[queueIdx]->TryPush(task)) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
             _taskQueue.emplace(std::move(task));
+            _overflowSize.fetch_add(1, std::memory_order_release);
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_parkedThreads.load(std::memory_order_seq_cst) > 0) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_wakeups < _parkedThreads.load(std::memory_order_relaxed)) {
+                    ++_wakeups;
+                }
+            }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -280,9 +446,19 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    // per stream thread queues, the idle stream threads steal the tasks from the others queues
+    static constexpr std::size_t taskQueueCapacity = 1024;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::atomic<std::size_t> _nextQueueIdx{0};
+    // overflow queue, used only if the stream queue is full
+    std::mutex _overflowMutex;
+    std::queue<Task> _taskQueue;
+    std::atomic<std::size_t> _overflowSize{0};
+    // parking of the idle stream threads
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::atomic<int> _parkedThreads{0};
+    int _wakeups = 0;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -27,7 +28,10 @@
 namespace AutoBatchPlugin {
 using namespace InferenceEngine;
 
-std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CONFIG_KEY(AUTO_BATCH_TIMEOUT)};
+std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
+                                                 CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 CONFIG_KEY(AUTO_BATCH_LATENCY_SLO),
+                                                 CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)};
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
@@ -333,13 +337,39 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name),
+                         _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         true,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToPartialBatch(SoIInferRequestInternal& req,
+                                                     size_t position,
+                                                     size_t batchSize) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, position, batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromPartialBatch(SoIInferRequestInternal& req,
+                                                        size_t position,
+                                                        size_t batchSize) {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, position, batchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -347,13 +377,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -365,7 +395,11 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         _batchId,
+                         _batchSize);
     }
 }
 
@@ -384,10 +418,13 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            workerInferRequest._timeoutController.OnArrival();
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = workerInferRequest._tasks.size();
-            if (sz == workerInferRequest._batchSize) {
+            // when the batch can not meet the latency target, the request is executed right away
+            if (sz == workerInferRequest._batchSize ||
+                workerInferRequest._timeoutController.GetEffectiveBatchSize() == 1) {
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -411,6 +448,8 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_partialBatchRequest->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -427,6 +466,7 @@ AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
 AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
     const InferenceEngine::SoExecutableNetworkInternal& networkWithoutBatch,
+    const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksPartialBatch,
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
@@ -435,6 +475,7 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _networksPartial{networksPartialBatch},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -442,7 +483,13 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     _device = networkDevice;
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
-    _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    _timeOut = ParseTimeoutValue(time_out->second.as<std::string>(), CONFIG_KEY(AUTO_BATCH_TIMEOUT));
+    unsigned int latencySLO = 0;
+    auto slo = config.find(CONFIG_KEY(AUTO_BATCH_LATENCY_SLO));
+    if (slo != config.end())
+        latencySLO = ParseTimeoutValue(slo->second.as<std::string>(), CONFIG_KEY(AUTO_BATCH_LATENCY_SLO));
+    _timeoutController.reset(new BatchTimeoutController(_device.batchForDevice, latencySLO));
+    _timeoutController->Update(_timeOut, 1);
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -453,10 +500,10 @@ AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
     _workerRequests.clear();
 }
 
-unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s) {
+unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s, const std::string& key) {
     auto val = std::stoi(s);
     if (val < 0)
-        IE_THROW(ParameterMismatch) << "Value for the " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " should be unsigned int";
+        IE_THROW(ParameterMismatch) << "Value for the " << key << " should be unsigned int";
     return val;
 }
 
@@ -500,15 +547,21 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
     std::lock_guard<std::mutex> lock(_workerRequestsMutex);
     auto batch_id = num % _device.batchForDevice;
     if (!batch_id) {  // need new request
-        _workerRequests.push_back(std::make_shared<WorkerInferRequest>());
+        _workerRequests.push_back(std::make_shared<WorkerInferRequest>(*_timeoutController));
         auto workerRequestPtr = _workerRequests.back().get();
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
+        for (auto& partial : _networksPartial)
+            workerRequestPtr->_inferRequestsPartial[partial.first] = {partial.second->CreateInferRequest(),
+                                                                      partial.second._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                else
+                    workerRequestPtr->_timeoutController.OnBatchedCompleted(BatchTimeoutController::Clock::now() -
+                                                                            workerRequestPtr->_batchedStart);
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -523,7 +576,14 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    size_t numWorkers;
+                    {
+                        std::lock_guard<std::mutex> workersLock(_workerRequestsMutex);
+                        numWorkers = _workerRequests.size();
+                    }
+                    // in the adaptive mode the timeout is re-evaluated from the latest statistics before each wait
+                    const auto timeOut = _timeoutController->Update(_timeOut, numWorkers);
+                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(timeOut));
                 }
                 if (_terminate) {
                     break;
@@ -540,20 +600,72 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_batchedStart = BatchTimeoutController::Clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
-                    } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                    } else if ((status == std::cv_status::timeout ||
+                                workerRequestPtr->_timeoutController.GetEffectiveBatchSize() == 1) &&
+                               sz) {
+                        // timeout to collect the batch is over (or the batch can not meet the latency target),
+                        // have to execute the requests as the partial batches (if compiled) or in the batch1 mode
+                        std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> tasks(sz);
+                        // popping all tasks collected by the moment of the time-out
+                        for (int n = 0; n < sz; n++)
+                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[n]));
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        const auto start = BatchTimeoutController::Clock::now();
+                        // each partial request runs at most once per dispatch, so only the smaller ones follow
+                        // (some sizes may be missing, e.g. when their compilation failed)
+                        int maxPartialSize = sz;
+                        for (int n = 0; n < sz;) {
+                            // the largest partial batch that fits the rest of the requests
+                            auto partial =
+                                workerRequestPtr->_inferRequestsPartial.upper_bound(std::min(sz - n, maxPartialSize));
+                            if (partial != workerRequestPtr->_inferRequestsPartial.begin()) {
+                                --partial;
+                                const int partialSize = partial->first;
+                                maxPartialSize = partialSize - 1;
+                                auto& partialRequest = partial->second;
+                                const std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> group(
+                                    tasks.begin() + n,
+                                    tasks.begin() + n + partialSize);
+                                for (int r = 0; r < partialSize; r++) {
+                                    auto& inferRequest = group[r].first->_inferRequest;
+                                    inferRequest->CopyInputsToPartialBatch(partialRequest, r, partialSize);
+                                    inferRequest->_partialBatchRequest = partialRequest;
+                                    inferRequest->_wasBatchedRequestUsed =
+                                        AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                                }
+                                partialRequest->SetCallback(
+                                    [group, partialSize, sz, workerRequestPtr, &arrived, &all_completed](
+                                        std::exception_ptr p) {
+                                        auto& partialRequest = workerRequestPtr->_inferRequestsPartial.at(partialSize);
+                                        for (int r = 0; r < partialSize; r++) {
+                                            auto& inferRequest = group[r].first->_inferRequest;
+                                            if (p)
+                                                inferRequest->_exceptionPtr = p;
+                                            else
+                                                inferRequest->CopyOutputsFromPartialBatch(partialRequest,
+                                                                                          r,
+                                                                                          partialSize);
+                                            group[r].second();
+                                        }
+                                        if (sz == (arrived += partialSize))
+                                            all_completed.set_value();
+                                    });
+                                partialRequest->StartAsync();
+                                n += partialSize;
+                                continue;
+                            }
+                            auto& t = tasks[n++];
                             t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                [t, sz, start, workerRequestPtr, &arrived, &all_completed](std::exception_ptr p) {
                                     if (p)
                                         t.first->_inferRequest->_exceptionPtr = p;
+                                    else
+                                        workerRequestPtr->_timeoutController.OnSingleCompleted(
+                                            BatchTimeoutController::Clock::now() - start);
                                     t.second();
                                     if (sz == ++arrived)
                                         all_completed.set_value();
@@ -598,13 +710,21 @@ std::shared_ptr<ngraph::Function> AutoBatchExecutableNetwork::GetExecGraphInfo()
 }
 
 void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) {
-    auto timeout = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
-    if (timeout == config.end() || config.size() > 1) {
-        IE_THROW() << "The only config that can be changed on the fly for the AutoBatching the is the "
-                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT);
-    } else {
-        _timeOut = ParseTimeoutValue(timeout->second.as<std::string>());
+    for (auto&& kvp : config) {
+        if (kvp.first != CONFIG_KEY(AUTO_BATCH_TIMEOUT) && kvp.first != CONFIG_KEY(AUTO_BATCH_LATENCY_SLO))
+            IE_THROW() << "The only configs that can be changed on the fly for the AutoBatching are the "
+                       << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " and the " << CONFIG_KEY(AUTO_BATCH_LATENCY_SLO);
+    }
+    for (auto&& kvp : config) {
+        const auto value = ParseTimeoutValue(kvp.second.as<std::string>(), kvp.first);
+        if (kvp.first == CONFIG_KEY(AUTO_BATCH_TIMEOUT))
+            _timeOut = value;
+        else
+            _timeoutController->SetLatencySLO(value);
     }
+    // refresh the reported values without waiting for the next batch collection
+    std::lock_guard<std::mutex> lock(_workerRequestsMutex);
+    _timeoutController->Update(_timeOut, _workerRequests.size());
 }
 
 InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string& name) const {
@@ -644,10 +764,18 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
                              {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
-                              METRIC_KEY(SUPPORTED_CONFIG_KEYS)});
+                              METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+                              METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT),
+                              METRIC_KEY(AUTO_BATCH_EFFECTIVE_BATCH_SIZE)});
+    } else if (name == METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT)) {
+        IE_SET_METRIC_RETURN(AUTO_BATCH_ADAPTIVE_TIMEOUT, _timeoutController->GetTimeout());
+    } else if (name == METRIC_KEY(AUTO_BATCH_EFFECTIVE_BATCH_SIZE)) {
+        IE_SET_METRIC_RETURN(AUTO_BATCH_EFFECTIVE_BATCH_SIZE,
+                             static_cast<unsigned int>(_timeoutController->GetEffectiveBatchSize()));
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        // only timeouts can be changed on the fly
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
-                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
+                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT), CONFIG_KEY(AUTO_BATCH_LATENCY_SLO)});
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
@@ -753,14 +881,16 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)) {
+            if (val != CONFIG_VALUE(YES) && val != CONFIG_VALUE(NO))
+                IE_THROW(ParameterMismatch) << " Expecting YES/NO value for " << name << " got " << val;
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) || name == CONFIG_KEY(AUTO_BATCH_LATENCY_SLO)) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception& e) {
-                IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                IE_THROW(ParameterMismatch) << " Expecting unsigned int value for " << name << " got " << val;
             }
         }
     }
@@ -779,6 +909,9 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[CONFIG_KEY(AUTO_BATCH_LATENCY_SLO)] = "0";  // adaptive timeout is disabled by default
+    // the extra networks take the device memory, so the partial batches are enabled explicitly
+    _config[CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)] = CONFIG_VALUE(NO);
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -948,23 +1081,39 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
+    auto loadBatched = [&](int batch) {
+        CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+        ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+        for (const auto& input : batched_inputs)
+            shapes[input][0] = batch;
+        reshaped.reshape(shapes);
+        return ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                   : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+    };
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> executableNetworksPartialBatch;
     if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
-            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
-            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
-            for (const auto& input : batched_inputs)
-                shapes[input][0] = metaDevice.batchForDevice;
-            reshaped.reshape(shapes);
-            executableNetworkWithBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
-                                             : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            executableNetworkWithBatch = loadBatched(metaDevice.batchForDevice);
         } catch (...) {
             metaDevice.batchForDevice = 1;
         }
     }
+    const auto partial = fullConfig.find(CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES));
+    if (executableNetworkWithBatch && partial != fullConfig.end() && partial->second == CONFIG_VALUE(YES)) {
+        // the power of 2 batches below the full one, so any number of the collected requests is covered by few of them
+        for (int batch = 2; batch < metaDevice.batchForDevice; batch *= 2) {
+            try {
+                executableNetworksPartialBatch[batch] = loadBatched(batch);
+            } catch (...) {
+                // the remaining requests will be executed with the smaller batches
+            }
+        }
+    }
 
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
+                                                        executableNetworksPartialBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "batch_timeout_controller.hpp"
 #include "cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp"
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
@@ -36,6 +37,8 @@ public:
     struct WorkerInferRequest {
         using Ptr = std::shared_ptr<WorkerInferRequest>;
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
+        // requests of the networks compiled for the partial batches, by the batch size
+        std::map<int, InferenceEngine::SoIInferRequestInternal> _inferRequestsPartial;
         int _batchSize;
         InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
         std::vector<InferenceEngine::Task> _completionTasks;
@@ -43,11 +46,17 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        BatchTimeoutController& _timeoutController;
+        BatchTimeoutController::Clock::time_point _batchedStart;
+
+        explicit WorkerInferRequest(BatchTimeoutController& timeoutController)
+            : _timeoutController(timeoutController) {}
     };
 
     explicit AutoBatchExecutableNetwork(
         const InferenceEngine::SoExecutableNetworkInternal& networkForDevice,
         const InferenceEngine::SoExecutableNetworkInternal& networkForDeviceWithoutBatch,
+        const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksForDevicePartialBatch,
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
@@ -68,11 +77,12 @@ public:
     virtual ~AutoBatchExecutableNetwork();
 
 protected:
-    static unsigned int ParseTimeoutValue(const std::string&);
+    static unsigned int ParseTimeoutValue(const std::string& value, const std::string& key);
     std::atomic_bool _terminate = {false};
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> _networksPartial;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
@@ -82,6 +92,7 @@ protected:
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    std::unique_ptr<BatchTimeoutController> _timeoutController;
 
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
@@ -109,16 +120,25 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // copies the data to/from the given position of the request executing the partial batch
+    void CopyInputsToPartialBatch(InferenceEngine::SoIInferRequestInternal& req, size_t position, size_t batchSize);
+    void CopyOutputsFromPartialBatch(InferenceEngine::SoIInferRequestInternal& req, size_t position, size_t batchSize);
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        PARTIAL_BATCH_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    InferenceEngine::SoIInferRequestInternal _partialBatchRequest;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
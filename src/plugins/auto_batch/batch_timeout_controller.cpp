@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "batch_timeout_controller.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace AutoBatchPlugin {
+
+namespace {
+// the weight of the new measurement in the moving averages
+constexpr double smoothingFactor = 0.2;
+// the margin for the jitter of the arrivals when the batch is collected while missing the target
+constexpr double fillTimeMargin = 1.5;
+}  // namespace
+
+BatchTimeoutController::BatchTimeoutController(int batchSize, unsigned int latencySLO)
+    : _batchSize{batchSize},
+      _latencySLO{latencySLO},
+      _effectiveBatchSize{batchSize} {}
+
+void BatchTimeoutController::SetLatencySLO(unsigned int latencySLO) {
+    _latencySLO = latencySLO;
+}
+
+void BatchTimeoutController::Accumulate(double& average, double value) {
+    average = average < 0 ? value : average + smoothingFactor * (value - average);
+}
+
+void BatchTimeoutController::OnArrival() {
+    const auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_arrived)
+        Accumulate(_arrivalInterval, Duration(now - _lastArrival).count());
+    _lastArrival = now;
+    _arrived = true;
+}
+
+void BatchTimeoutController::OnBatchedCompleted(Duration latency) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Accumulate(_batchedLatency, latency.count());
+}
+
+void BatchTimeoutController::OnSingleCompleted(Duration latency) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Accumulate(_singleLatency, latency.count());
+}
+
+unsigned int BatchTimeoutController::Update(unsigned int maxTimeout, size_t numWorkers) {
+    const unsigned int latencySLO = _latencySLO;
+    if (!latencySLO) {
+        _timeout = maxTimeout;
+        _effectiveBatchSize = _batchSize;
+        return maxTimeout;
+    }
+    double arrivalInterval, batchedLatency, singleLatency;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        arrivalInterval = _arrivalInterval;
+        batchedLatency = _batchedLatency;
+        singleLatency = _singleLatency;
+    }
+
+    // until the batched execution is measured, the whole target is the budget for the waiting
+    const double budget = latencySLO - std::max(batchedLatency, 0.0);
+    double timeout = budget;
+    int batchSize = _batchSize;
+    if (arrivalInterval >= 0) {
+        // the requests are distributed between the batched requests, so each collects its batch from the share of them
+        const double fillTime = (_batchSize - 1) * arrivalInterval * std::max<size_t>(numWorkers, 1);
+        if (fillTime <= budget) {
+            // the batch meets the target, the rest of the budget covers the jitter of the arrivals
+        } else if (batchedLatency >= 0 && singleLatency >= 0 && fillTime <= maxTimeout &&
+                   fillTime + batchedLatency < singleLatency) {
+            // the target is missed anyway, but the batch is still faster than the (overloaded) batch1 execution
+            timeout = fillTime * fillTimeMargin;
+        } else {
+            // waiting for the batch only adds the latency, the requests go to the non-batched network right away
+            timeout = 0;
+            batchSize = 1;
+        }
+    }
+    // the zero timeout would spin the worker thread, so at least 1 ms unless the user asked for 0 explicitly
+    const auto result = std::min(std::max(static_cast<unsigned int>(std::lround(std::max(timeout, 0.0))), 1u),
+                                 maxTimeout);
+    _timeout = result;
+    _effectiveBatchSize = batchSize;
+    return result;
+}
+
+}  // namespace AutoBatchPlugin
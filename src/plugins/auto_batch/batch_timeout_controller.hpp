@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace AutoBatchPlugin {
+
+/**
+ * @brief Online choice of the timeout to collect the batch for the latency target (SLO).
+ * The interval between the requests arrivals, the latency of the batched and of the non-batched (batch1) execution are
+ * tracked with the exponential moving averages. The batch is collected only while the expected time to fill it plus the
+ * batched latency meets the target (or at least is lower than the batch1 latency), otherwise the requests are executed
+ * by the non-batched network without waiting.
+ */
+class BatchTimeoutController {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    /**
+     * @param batchSize The batch size of the device network
+     * @param latencySLO The latency target in ms, 0 - the adaptive mode is disabled
+     */
+    BatchTimeoutController(int batchSize, unsigned int latencySLO);
+
+    void SetLatencySLO(unsigned int latencySLO);
+    bool IsAdaptive() const {
+        return _latencySLO != 0;
+    }
+
+    /**
+     * @brief Records the arrival of the request, can be called from the multiple threads
+     */
+    void OnArrival();
+    void OnBatchedCompleted(Duration latency);
+    void OnSingleCompleted(Duration latency);
+
+    /**
+     * @brief Chooses the timeout (in ms) and the effective batch size from the collected statistics
+     * @param maxTimeout The AUTO_BATCH_TIMEOUT, the chosen timeout does not exceed it
+     * @param numWorkers The number of the batched requests the arrivals are distributed between
+     */
+    unsigned int Update(unsigned int maxTimeout, size_t numWorkers);
+
+    unsigned int GetTimeout() const {
+        return _timeout;
+    }
+    int GetEffectiveBatchSize() const {
+        return _effectiveBatchSize;
+    }
+
+private:
+    static void Accumulate(double& average, double value);
+
+    const int _batchSize;
+    std::atomic_uint _latencySLO;
+
+    mutable std::mutex _mutex;
+    bool _arrived = false;
+    Clock::time_point _lastArrival;
+    // the averages in ms, negative until the first measurement
+    double _arrivalInterval = -1.0;
+    double _batchedLatency = -1.0;
+    double _singleLatency = -1.0;
+
+    std::atomic_uint _timeout = {0};
+    std::atomic_int _effectiveBatchSize;
+};
+
+}  // namespace AutoBatchPlugin
@@ -18,24 +18,45 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
+            RequestExecutor(SoIInferRequestInternal& inferRequest, const PipelineStage::Ptr& stage)
+                : _inferRequest(inferRequest),
+                  _stage(stage) {
                 _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
-                    _exceptionPtr = exceptionPtr;
-                    auto capturedTask = std::move(_task);
-                    capturedTask();
+                    Complete(exceptionPtr);
                 });
             }
             void run(Task task) override {
                 _task = std::move(task);
-                _inferRequest->StartAsync();
+                if (!_stage) {
+                    _inferRequest->StartAsync();
+                    return;
+                }
+                // the request may be started later by the thread completing the previous request of the stage,
+                // so the start failure is reported through the pipeline instead of the exception
+                _stage->Run([this] {
+                    try {
+                        _inferRequest->StartAsync();
+                    } catch (...) {
+                        Complete(std::current_exception());
+                    }
+                });
             };
+            void Complete(std::exception_ptr exceptionPtr) {
+                _exceptionPtr = exceptionPtr;
+                if (_stage) {
+                    _stage->Complete();
+                }
+                auto capturedTask = std::move(_task);
+                capturedTask();
+            }
             SoIInferRequestInternal& _inferRequest;
+            PipelineStage::Ptr _stage;
             std::exception_ptr _exceptionPtr;
             Task _task;
         };
 
-        auto requestExecutor =
-            std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
+        auto& requestDesc = _heteroInferRequest->_inferRequests[requestId];
+        auto requestExecutor = std::make_shared<RequestExecutor>(requestDesc._request, requestDesc._stage);
         _pipeline.emplace_back(requestExecutor, [requestExecutor] {
             if (nullptr != requestExecutor->_exceptionPtr) {
                 std::rethrow_exception(requestExecutor->_exceptionPtr);
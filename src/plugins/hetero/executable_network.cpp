@@ -516,6 +516,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                                                                  network._device,
                                                                  metaDevices[network._device]);
     }
+    InitPipelineStages();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
@@ -671,6 +672,28 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitPipelineStages();
+}
+
+void HeteroExecutableNetwork::InitPipelineStages() {
+    std::size_t maxRequests = 0;
+    auto it = _config.find(HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS));
+    if (it != _config.end()) {
+        int value = -1;
+        try {
+            value = std::stoi(it->second);
+        } catch (const std::exception&) {
+        }
+        if (value < 0) {
+            IE_THROW() << "Wrong value for property key " << HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS)
+                       << ". Expected only non negative integer numbers";
+        }
+        maxRequests = static_cast<std::size_t>(value);
+    }
+    _stages.clear();
+    for (std::size_t i = 0; i < _networks.size(); ++i) {
+        _stages.push_back(std::make_shared<PipelineStage>(maxRequests));
+    }
 }
 
 void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
@@ -814,6 +837,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
+        desc._stage = _stages[index];
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
@@ -827,6 +851,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
+        desc._stage = _stages[index];
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
@@ -853,6 +878,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{"0"};
     } else {
         // find config key among plugin config keys
         for (auto&& desc : _networks) {
@@ -911,7 +939,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroMetrics = {ov::model_name.name(),
                                                   METRIC_KEY(SUPPORTED_METRICS),
                                                   METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                                                  ov::optimal_number_of_infer_requests.name()};
+                                                  ov::optimal_number_of_infer_requests.name(),
+                                                  METRIC_KEY(HETERO_PIPELINE_STAGES_UTILIZATION)};
 
         {
             std::vector<::Metrics> pluginMetrics;
@@ -933,6 +962,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -960,6 +990,12 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
                              desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
+    } else if (METRIC_KEY(HETERO_PIPELINE_STAGES_UTILIZATION) == name) {
+        std::map<std::string, float> utilization;
+        for (std::size_t i = 0; i < _stages.size(); ++i) {
+            utilization["subgraph" + std::to_string(i) + ": " + _networks[i]._device] = _stages[i]->GetUtilization();
+        }
+        IE_SET_METRIC_RETURN(HETERO_PIPELINE_STAGES_UTILIZATION, utilization);
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : _networks) {
@@ -21,6 +21,7 @@
 #include "async_infer_request.hpp"
 #include "ie_icore.hpp"
 #include "infer_request.hpp"
+#include "pipeline_stage.hpp"
 
 namespace HeteroPlugin {
 
@@ -65,6 +66,7 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    void InitPipelineStages();
 
     struct NetworkDesc {
         std::string _device;
@@ -73,6 +75,7 @@ private:
     };
 
     std::vector<NetworkDesc> _networks;
+    std::vector<PipelineStage::Ptr> _stages;
     Engine* _heteroPlugin;
     std::string _name;
     std::map<std::string, std::string> _config;
@@ -15,6 +15,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "pipeline_stage.hpp"
+
 namespace HeteroPlugin {
 
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -25,6 +27,7 @@ public:
         InferenceEngine::SoExecutableNetworkInternal _network;
         InferenceEngine::SoIInferRequestInternal _request;
         openvino::itt::handle_t _profilingTask;
+        PipelineStage::Ptr _stage;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stage.hpp"
+
+#include <utility>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+PipelineStage::PipelineStage(std::size_t maxRequests) : _maxRequests{maxRequests} {}
+
+void PipelineStage::Run(Task start) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        const auto now = Clock::now();
+        if (!_started) {
+            _firstStart = now;
+            _started = true;
+        }
+        if (_maxRequests != 0 && _runningRequests >= _maxRequests) {
+            _queue.emplace_back(std::move(start));
+            return;
+        }
+        if (_runningRequests++ == 0) {
+            _busyStart = now;
+        }
+    }
+    start();
+}
+
+void PipelineStage::Complete() {
+    Task next;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (!_queue.empty()) {
+            // the place of the completed request is passed to the queued one, so the stage stays busy
+            next = std::move(_queue.front());
+            _queue.pop_front();
+        } else if (--_runningRequests == 0) {
+            _busyTime += Clock::now() - _busyStart;
+        }
+    }
+    if (next) {
+        next();
+    }
+}
+
+float PipelineStage::GetUtilization() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (!_started) {
+        return 0.f;
+    }
+    const auto now = Clock::now();
+    auto busyTime = _busyTime;
+    if (_runningRequests != 0) {
+        busyTime += now - _busyStart;
+    }
+    const auto totalTime = now - _firstStart;
+    return totalTime.count() > 0 ? static_cast<float>(busyTime.count()) / static_cast<float>(totalTime.count()) : 0.f;
+}
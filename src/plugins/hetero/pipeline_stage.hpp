@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "threading/ie_itask_executor.hpp"
+
+namespace HeteroPlugin {
+
+/**
+ * @brief The subgraph stage of the pipelined execution of the asynchronous infer requests.
+ * At most the given number of the requests are executed by the subgraph at the same time, the next ones wait in the FIFO
+ * queue of the stage, while the previous requests go on with the next subgraphs. The busy time of the stage is collected
+ * for the utilization metric.
+ */
+class PipelineStage {
+public:
+    using Ptr = std::shared_ptr<PipelineStage>;
+
+    /**
+     * @param maxRequests The maximal number of the requests executed by the stage at the same time, 0 - no limit
+     */
+    explicit PipelineStage(std::size_t maxRequests);
+
+    /**
+     * @brief Runs the task which starts the request execution by the subgraph or queues it if the stage is full
+     * @note Complete() must be called when the request execution is completed or the task failed to start it
+     */
+    void Run(InferenceEngine::Task start);
+
+    /**
+     * @brief Releases the place of the completed request and starts the next queued one
+     */
+    void Complete();
+
+    /**
+     * @brief The part of the time since the first request of the stage when at least one request was executed by it
+     */
+    float GetUtilization() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    mutable std::mutex _mutex;
+    std::size_t _maxRequests;
+    std::size_t _runningRequests = 0;
+    std::deque<InferenceEngine::Task> _queue;
+
+    bool _started = false;
+    Clock::time_point _firstStart;
+    Clock::time_point _busyStart;
+    Clock::duration _busyTime{0};
+};
+
+}  // namespace HeteroPlugin
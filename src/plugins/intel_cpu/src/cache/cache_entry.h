@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <functional>
 #include "lru_cache.h"
@@ -11,6 +12,19 @@
 namespace ov {
 namespace intel_cpu {
 
+struct CacheStatistics {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        return *this;
+    }
+};
+
 class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t {
@@ -19,14 +33,15 @@ public:
     };
 public:
     virtual ~CacheEntryBase() = default;
+    virtual CacheStatistics getStatistics() const = 0;
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const KeyType&),
+ *         getCapacity() and getEvictionsCount() interface and must have constructor of type ImplType(size_t, ...).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -39,7 +54,8 @@ public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
 public:
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    template<typename... Args>
+    explicit CacheEntry(size_t capacity, Args&&... args) : _impl(capacity, std::forward<Args>(args)...) {}
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
@@ -52,6 +68,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -62,12 +79,27 @@ public:
             retVal = builder(key);
             if (retVal != retEmpty)
                 _impl.put(key, retVal);
+            _misses.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            _hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
 
+    CacheStatistics getStatistics() const override {
+        CacheStatistics result;
+        result.hits = _hits.load(std::memory_order_relaxed);
+        result.misses = _misses.load(std::memory_order_relaxed);
+        result.evictions = _impl.getEvictionsCount();
+        return result;
+    }
+
 public:
     ImplType _impl;
+
+private:
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
 };
 
 }   // namespace intel_cpu
@@ -9,5 +9,21 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheStatistics MultiCache::getStatistics() const {
+    CacheStatistics result;
+    std::lock_guard<std::mutex> lock(*_storageMutex);
+    for (const auto& entry : _storage) {
+        result += entry.second->getStatistics();
+    }
+    return result;
+}
+
+CacheStatistics MultiCache::getSharedLookupStatistics() const {
+    CacheStatistics result;
+    result.hits = _sharedLookups->hits.load(std::memory_order_relaxed);
+    result.misses = _sharedLookups->misses.load(std::memory_order_relaxed);
+    return result;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -7,21 +7,42 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
+
+namespace dnnl {
+struct primitive;
+}   // namespace dnnl
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Tells whether the cached values of the type may be used by several streams at once. Only the immutable values
+ * qualify: the oneDNN primitives are built with the concurrent execution support, while the node executors keep the
+ * mutable scratch data (e.g. the Interpolate index table) and must stay private to a stream.
+ */
+template<typename ValueType>
+struct is_stream_shareable : std::false_type {};
+
+template<>
+struct is_stream_shareable<std::shared_ptr<dnnl::primitive>> : std::true_type {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * The cache is thread safe, but the values it stores may be not, so a stream uses a cache of its own, which may
+ * delegate the stream shareable values to a cache shared among the streams. Each entry is split into the number of
+ * independently locked shards to reduce the contention between the streams.
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
-    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
@@ -29,9 +50,17 @@ public:
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param shards number of independently locked shards of each entry. One shard provides the strict LRU policy,
+    *       more shards are beneficial when the cache is accessed concurrently.
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, size_t shards = 1) : _capacity(capacity), _shards(shards) {}
+
+    /**
+    * @param shared the cache that stores the stream shareable values instead of this one
+    */
+    MultiCache(size_t capacity, std::shared_ptr<MultiCache> shared)
+        : _capacity(capacity), _shards(1), _shared(std::move(shared)) {}
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,10 +74,28 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
+        if (is_stream_shareable<ValueType>::value && _shared) {
+            auto result = _shared->getOrCreate(key, std::move(builder));
+            auto& counter = result.second == CacheEntryBase::LookUpStatus::Hit ? _sharedLookups->hits
+                                                                               : _sharedLookups->misses;
+            counter.fetch_add(1, std::memory_order_relaxed);
+            return result;
+        }
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns the hit/miss/eviction counters accumulated over all the entries, the shared cache is not included
+    */
+    CacheStatistics getStatistics() const;
+
+    /**
+    * @brief Returns the hit/miss counters of the lookups this cache delegated to the shared cache, so the lookups of
+    *       the owner are told apart from the ones of the other owners of the shared cache. There are no evictions.
+    */
+    CacheStatistics getSharedLookupStatistics() const;
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -58,7 +105,16 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _shards;
+    std::shared_ptr<MultiCache> _shared;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    std::shared_ptr<std::mutex> _storageMutex = std::make_shared<std::mutex>();
+
+    struct SharedLookups {
+        std::atomic_size_t hits{0};
+        std::atomic_size_t misses{0};
+    };
+    std::shared_ptr<SharedLookups> _sharedLookups = std::make_shared<SharedLookups>();
 };
 
 template<typename T>
@@ -71,9 +127,10 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(*_storageMutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity, _shards)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
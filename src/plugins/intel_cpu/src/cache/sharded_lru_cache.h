@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The records are distributed over a number of independent LruCache shards by the key hash and each shard
+ * is guarded by its own mutex, so concurrent lookups of different keys rarely contend for the same lock.
+ * The LRU order is maintained per shard.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    /**
+     * @param capacity total records limit, it is evenly split among the shards
+     * @param shards number of the shards, one shard provides the strict LRU policy over all the records
+     */
+    explicit ShardedLruCache(size_t capacity, size_t shards = 1) : _capacity(capacity) {
+        shards = std::max<size_t>(1, std::min(shards, capacity));
+        const size_t shardCapacity = (capacity + shards - 1) / shards;
+        _shards.reserve(shards);
+        for (size_t i = 0; i < shards; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key &key, const Value &val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard._mutex);
+        shard._cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard._mutex);
+        return shard._cache.get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->_mutex);
+            shard->_cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the total number of the evicted records
+     * @return the number of the evicted records
+     */
+    size_t getEvictionsCount() const {
+        size_t result = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->_mutex);
+            result += shard->_cache.getEvictionsCount();
+        }
+        return result;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : _cache(capacity) {}
+
+        mutable std::mutex _mutex;
+        LruCache<Key, Value> _cache;
+    };
+
+    Shard& getShard(const Key &key) {
+        if (_shards.size() == 1) {
+            return *_shards.front();
+        }
+        return *_shards[static_cast<size_t>(key.hash()) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -148,6 +148,74 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING == key) {
+            if (val == PluginConfigInternalParams::STREAM)
+                rtCacheSharing = RuntimeCacheSharing::PerStream;
+            else if (val == PluginConfigInternalParams::NETWORK)
+                rtCacheSharing = RuntimeCacheSharing::PerNetwork;
+            else if (val == PluginConfigInternalParams::PROCESS)
+                rtCacheSharing = RuntimeCacheSharing::PerProcess;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING
+                           << ". Expected only STREAM/NETWORK/PROCESS";
+        } else if (PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM == key) {
+            if (val == PluginConfigParams::YES) interOpParallelism = true;
+            else if (val == PluginConfigParams::NO) interOpParallelism = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA == key) {
+            if (val == PluginConfigParams::YES) dynamicMemoryArena = true;
+            else if (val == PluginConfigParams::NO) dynamicMemoryArena = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PERSISTENT_WEIGHTS_CACHE == key) {
+            if (val == PluginConfigParams::YES) persistentWeightsCache = true;
+            else if (val == PluginConfigParams::NO) persistentWeightsCache = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PERSISTENT_WEIGHTS_CACHE
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_EXPORT_COMPILED_GRAPH == key) {
+            if (val == PluginConfigParams::YES) exportCompiledGraph = true;
+            else if (val == PluginConfigParams::NO) exportCompiledGraph = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_EXPORT_COMPILED_GRAPH
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_HUGE_PAGES == key) {
+            if (val == PluginConfigParams::NO)
+                hugePages = HugePagesMode::Disabled;
+            else if (val == PluginConfigInternalParams::TRANSPARENT)
+                hugePages = HugePagesMode::Transparent;
+            else if (val == PluginConfigInternalParams::EXPLICIT)
+                hugePages = HugePagesMode::Explicit;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HUGE_PAGES
+                           << ". Expected only NO/TRANSPARENT/EXPLICIT";
+        } else if (PluginConfigInternalParams::KEY_CPU_ZERO_COPY_OUTPUTS == key) {
+            if (val == PluginConfigParams::YES) zeroCopyOutputs = true;
+            else if (val == PluginConfigParams::NO) zeroCopyOutputs = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_ZERO_COPY_OUTPUTS
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SHAPE_VARIANTS == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHAPE_VARIANTS
+                           << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHAPE_VARIANTS
+                           << ". Expected only non negative integer numbers";
+            shapeVariants = static_cast<size_t>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_SNIPPETS == key) {
+            if (val == PluginConfigParams::YES) dynamicSnippets = true;
+            else if (val == PluginConfigParams::NO) dynamicSnippets = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_SNIPPETS
+                           << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
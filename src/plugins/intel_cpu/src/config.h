@@ -7,6 +7,7 @@
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
 #include "utils/debug_capabilities.h"
+#include "cpu_memory.h"
 
 #include <string>
 #include <map>
@@ -22,12 +23,27 @@ struct Config {
         On,
     };
 
+    enum RuntimeCacheSharing {
+        PerStream,
+        PerNetwork,
+        PerProcess,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    RuntimeCacheSharing rtCacheSharing = RuntimeCacheSharing::PerStream;
+    bool interOpParallelism = false;
+    bool dynamicMemoryArena = false;
+    bool persistentWeightsCache = false;
+    bool exportCompiledGraph = false;
+    HugePagesMode hugePages = HugePagesMode::Disabled;
+    bool zeroCopyOutputs = false;
+    size_t shapeVariants = 0;
+    bool dynamicSnippets = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
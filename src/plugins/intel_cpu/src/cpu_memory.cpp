@@ -16,6 +16,11 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/reorder.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/general_utils.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
 using namespace InferenceEngine;
 using namespace dnnl;
@@ -199,6 +204,101 @@ void MemoryMngrWithReuse::destroy(void *ptr) {
     dnnl::impl::free(ptr);
 }
 
+namespace {
+// returns nullptr if the huge pages can't be used, the size is a multiple of the huge page size
+void* mapHugePages(size_t size, HugePagesMode mode) {
+#if defined(__linux__)
+    constexpr size_t hugePageSize = MemoryMngrWithHugePages::hugePageSize;
+#if defined(MAP_HUGETLB)
+    if (mode == HugePagesMode::Explicit) {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED)
+            return ptr;
+    }
+#endif
+#if defined(MADV_HUGEPAGE)
+    // the mapping is over-allocated and trimmed, so the buffer starts at the huge page boundary
+    void* raw = mmap(nullptr, size + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED)
+        return nullptr;
+    const auto rawAddr = reinterpret_cast<uintptr_t>(raw);
+    const auto alignedAddr = (rawAddr + hugePageSize - 1) / hugePageSize * hugePageSize;
+    if (alignedAddr != rawAddr)
+        munmap(raw, alignedAddr - rawAddr);
+    if (rawAddr + hugePageSize != alignedAddr)
+        munmap(reinterpret_cast<void*>(alignedAddr + size), rawAddr + hugePageSize - alignedAddr);
+    void* ptr = reinterpret_cast<void*>(alignedAddr);
+    if (madvise(ptr, size, MADV_HUGEPAGE) != 0) {
+        munmap(ptr, size);
+        return nullptr;
+    }
+    return ptr;
+#endif
+#endif
+    return nullptr;
+}
+}   // namespace
+
+MemoryMngrWithHugePages::~MemoryMngrWithHugePages() {
+    release();
+}
+
+void* MemoryMngrWithHugePages::getRawPtr() const noexcept {
+    return _data;
+}
+
+void MemoryMngrWithHugePages::setExtBuff(void *ptr, size_t size) {
+    release();
+    _useExternalStorage = true;
+    _memUpperBound = size;
+    _data = ptr;
+}
+
+bool MemoryMngrWithHugePages::resize(size_t size) {
+    constexpr int cacheLineSize = 64;
+    if (size <= _memUpperBound)
+        return false;
+
+    void* ptr = nullptr;
+    size_t mappedSize = 0;
+    // there is no point in the huge pages for the buffers smaller than a single page
+    if (_mode != HugePagesMode::Disabled && size >= hugePageSize) {
+        mappedSize = div_up(size, hugePageSize) * hugePageSize;
+        ptr = mapHugePages(mappedSize, _mode);
+        if (!ptr)
+            mappedSize = 0;
+    }
+    if (!ptr) {
+        ptr = dnnl::impl::malloc(size, cacheLineSize);
+        if (!ptr)
+            throw std::bad_alloc();
+    }
+
+    release();
+    _data = ptr;
+    _mappedSize = mappedSize;
+    _memUpperBound = size;
+    _useExternalStorage = false;
+    return true;
+}
+
+bool MemoryMngrWithHugePages::hasExtBuffer() const noexcept {
+    return _useExternalStorage;
+}
+
+void MemoryMngrWithHugePages::release() noexcept {
+    if (_data && !_useExternalStorage) {
+#if defined(__linux__)
+        if (_mappedSize)
+            munmap(_data, _mappedSize);
+        else
+#endif
+            dnnl::impl::free(_data);
+    }
+    _data = nullptr;
+    _mappedSize = 0;
+}
+
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
     return _pMemMngr->getRawPtr();
 }
@@ -89,6 +89,51 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief Kind of the huge pages used to back the large buffers
+ */
+enum class HugePagesMode {
+    Disabled,
+    // 2 MB transparent huge pages requested via madvise, the kernel may back the buffer with them
+    Transparent,
+    // explicit huge pages (MAP_HUGETLB) from the preallocated pool, transparent ones are used if the pool is exhausted
+    Explicit,
+};
+
+/**
+ * @brief The same as MemoryMngrWithReuse, but the buffers larger than a huge page are backed with huge pages
+ * to reduce the TLB pressure. Falls back to the ordinary allocation if huge pages are not available.
+ */
+class MemoryMngrWithHugePages : public IMemoryMngr {
+public:
+    explicit MemoryMngrWithHugePages(HugePagesMode mode) : _mode(mode) {}
+    ~MemoryMngrWithHugePages() override;
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+    /**
+     * @brief Checks whether the current buffer is mapped with the huge pages request (it's up to the kernel
+     * to back it with the huge pages in the transparent mode)
+     */
+    bool isHugePagesBacked() const noexcept {
+        return _mappedSize != 0;
+    }
+
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+private:
+    void release() noexcept;
+
+    HugePagesMode _mode;
+    bool _useExternalStorage = false;
+    size_t _memUpperBound = 0ul;
+    void* _data = nullptr;
+    // the size of the memory mapping, 0 if the buffer is allocated in the ordinary way or external
+    size_t _mappedSize = 0ul;
+};
+
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
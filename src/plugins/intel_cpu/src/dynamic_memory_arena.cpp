@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_memory_arena.h"
+
+#include <common/utils.hpp>
+#include "memory_solver.hpp"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Memory manager of a single arena slot. Works as MemoryMngrWithReuse, which is bound by the arena
+ * to the workspace region of the slot, and reports the requested sizes back to the arena.
+ */
+class DynamicMemoryArena::SlotMemoryMngr : public IMemoryMngr {
+public:
+    SlotMemoryMngr(DynamicMemoryArena::Ptr arena, size_t slotId) : _arena(std::move(arena)), _slotId(slotId) {}
+
+    void* getRawPtr() const noexcept override {
+        return _mngr.getRawPtr();
+    }
+
+    void setExtBuff(void* ptr, size_t size) override {
+        _mngr.setExtBuff(ptr, size);
+    }
+
+    bool resize(size_t size) override {
+        _arena->onResize(_slotId, size);
+        return _mngr.resize(size);
+    }
+
+    bool hasExtBuffer() const noexcept override {
+        return _mngr.hasExtBuffer();
+    }
+
+private:
+    DynamicMemoryArena::Ptr _arena;
+    size_t _slotId;
+    MemoryMngrWithReuse _mngr;
+};
+
+DnnlMemoryMngrPtr DynamicMemoryArena::registerSlot(int start, int finish) {
+    const size_t slotId = _slots.size();
+    auto mngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(new SlotMemoryMngr(shared_from_this(), slotId)));
+    _slots.push_back({start, finish, 0, 0, mngr});
+    return mngr;
+}
+
+void DynamicMemoryArena::onResize(size_t slotId, size_t size) {
+    auto& slot = _slots[slotId];
+    slot.requested = std::max(slot.requested, size);
+    // the slot has moved to a private buffer, so the plan must be rebuilt before the next inference
+    if (slot.requested > slot.capacity)
+        _outdated = true;
+}
+
+bool DynamicMemoryArena::updatePlan() {
+    if (!_outdated)
+        return false;
+
+    std::vector<MemorySolver::Box> boxes(_slots.size());
+    for (size_t i = 0; i < _slots.size(); i++) {
+        const auto& slot = _slots[i];
+        boxes[i] = {slot.start, slot.finish, static_cast<int64_t>(div_up(slot.requested, alignment)), static_cast<int64_t>(i)};
+    }
+
+    MemorySolver memSolver(boxes);
+    const size_t totalSize = static_cast<size_t>(memSolver.solve()) * alignment;
+
+    // the workspace grows monotonically to avoid reallocations on the shapes oscillation
+    decltype(_workspace) oldWorkspace{nullptr, [](void*) {}};
+    if (totalSize > _workspaceSize) {
+        void* ptr = dnnl::impl::malloc(totalSize, alignment);
+        if (!ptr) {
+            throw std::bad_alloc();
+        }
+        oldWorkspace = std::move(_workspace);
+        _workspace = decltype(_workspace)(ptr, dnnl::impl::free);
+        _workspaceSize = totalSize;
+    }
+
+    auto* base = static_cast<uint8_t*>(_workspace.get());
+    for (size_t i = 0; i < _slots.size(); i++) {
+        auto& slot = _slots[i];
+        slot.capacity = rnd_up(slot.requested, alignment);
+        if (auto mngr = slot.mngr.lock()) {
+            mngr->setExtBuff(base + memSolver.getOffset(static_cast<int>(i)) * alignment, slot.capacity);
+        }
+    }
+
+    _outdated = false;
+    return true;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief A single workspace shared by the edges with undefined memory upper bound (dynamic shapes).
+ *
+ * Each dynamic edge cluster is registered as a slot with its lifetime (execution order interval).
+ * During inference a slot tracks the largest size requested through its memory manager. When some
+ * slot outgrows the capacity assigned to it, the slot falls back to a private buffer for the rest of
+ * the inference and the plan is marked as outdated. The next call of updatePlan() re-solves the slots
+ * lifetimes with the observed sizes, grows the workspace (it never shrinks) and rebinds all the slots
+ * to the workspace, so in a steady state all dynamic edges are packed into a single buffer.
+ */
+class DynamicMemoryArena : public std::enable_shared_from_this<DynamicMemoryArena> {
+public:
+    using Ptr = std::shared_ptr<DynamicMemoryArena>;
+
+    /**
+     * @brief Registers a new slot
+     * @param start - execution index of the first use of the memory
+     * @param finish - execution index of the last use of the memory
+     * @return memory manager bound to the slot
+     */
+    DnnlMemoryMngrPtr registerSlot(int start, int finish);
+
+    /**
+     * @brief Recomputes the slots offsets if some slot has outgrown its capacity since the previous call
+     * @return true if the slots have been rebound, i.e. the memory of the dynamic edges has been moved
+     */
+    bool updatePlan();
+
+    size_t getWorkspaceSize() const {
+        return _workspaceSize;
+    }
+
+    size_t getSlotsNumber() const {
+        return _slots.size();
+    }
+
+private:
+    class SlotMemoryMngr;
+
+    struct Slot {
+        int start;
+        int finish;
+        size_t requested;
+        size_t capacity;
+        std::weak_ptr<DnnlMemoryMngr> mngr;
+    };
+
+    void onResize(size_t slotId, size_t size);
+
+    static constexpr size_t alignment = 64;  // cache line
+
+    std::vector<Slot> _slots;
+    std::unique_ptr<void, void (*)(void *)> _workspace{nullptr, [](void*) {}};
+    size_t _workspaceSize = 0;
+    bool _outdated = false;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
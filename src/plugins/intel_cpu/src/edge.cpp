@@ -277,6 +277,25 @@ void Edge::allocate(const void* mem_ptr) {
     status = Status::Allocated;
 }
 
+void Edge::allocate(DnnlMemoryMngrPtr memMngr) {
+    if (status != Status::NeedAllocation)
+        return;
+
+    if (memoryPtr)
+        IE_THROW() << "Unexpected behaviour: status == NeedAllocation but memory is already allocated.";
+
+    auto& inputDesc = getInputDesc();
+    auto& outputDesc = getOutputDesc();
+    if (!inputDesc.isCompatible(outputDesc))
+        IE_THROW() << "Cannot allocate memory for incompatible descriptors.";
+
+    auto parentPtr = getParent();
+    memoryPtr.reset(new Memory(parentPtr->getEngine()));
+
+    memoryPtr->Create(inputDesc, memMngr);
+    status = Status::Allocated;
+}
+
 std::string Edge::name() const {
     auto parentPtr = getParent();
     auto childPtr = getChild();
@@ -288,7 +307,12 @@ std::string Edge::name() const {
     return  result.str();
 }
 
-void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
+std::string Edge::weightsCacheKey() const {
+    const auto& desc = getDesc();
+    return name() + " " + desc.getPrecision().name() + " " + desc.serializeFormat() + " " + std::to_string(desc.getMaxMemSize());
+}
+
+void Edge::externalAllocate(WeightsSharing::Ptr weightsCache, HugePagesMode hugePages) {
     auto isInPlace = [](const NodePtr node, int port) -> bool {
         const auto& selected_pd = node->getSelectedPrimitiveDescriptor();
         if (selected_pd == nullptr)
@@ -316,18 +340,25 @@ void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
     bool isTheOnlyChildEdgeAtPort = getParent()->getChildEdgesAtPort(getInputNum()).size() == 1;
     bool isConcurrentUpdatePossible = isInPlace(getParent(), getInputNum()) || isInPlace(getChild(), getOutputNum()) || !isTheOnlyChildEdgeAtPort;
 
-    if (weightsCache && !isConcurrentUpdatePossible) {
-        auto alloc = [this] () {
+    auto allocateMemory = [this, hugePages] () {
+        if (hugePages != HugePagesMode::Disabled)
+            allocate(std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(new MemoryMngrWithHugePages(hugePages))));
+        else
             allocate();
+    };
+
+    if (weightsCache && !isConcurrentUpdatePossible) {
+        auto alloc = [this, &allocateMemory] () {
+            allocateMemory();
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        auto ptr = weightsCache->findOrCreate(weightsCacheKey(), alloc, false);
         memoryPtr = *ptr;
         useExternalMemory = true;
         status = Status::Allocated;
     } else {
-        allocate();
+        allocateMemory();
     }
 }
 
@@ -51,7 +51,8 @@ public:
 
     void init();
     void allocate(const void* mem_ptr = nullptr);
-    void externalAllocate(WeightsSharing::Ptr weightsCache);
+    void allocate(DnnlMemoryMngrPtr memMngr);
+    void externalAllocate(WeightsSharing::Ptr weightsCache, HugePagesMode hugePages = HugePagesMode::Disabled);
     void reuse(MemoryPtr ptr);
     void validate();
     void drop();
@@ -81,6 +82,8 @@ public:
 
 private:
     std::string name() const;
+    // the graphs created for the different input shapes may select the different layouts of the same constant
+    std::string weightsCacheKey() const;
 
     std::weak_ptr<Node> parent;
     std::weak_ptr<Node> child;
@@ -21,9 +21,11 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <ngraph/opsets/opset1.hpp>
+#include <openvino/op/util/read_value_base.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
@@ -56,6 +58,25 @@ ExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs
     return std::make_shared<LegacyInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<ExecNetwork>(shared_from_this()));
 }
 
+namespace {
+MultiCachePtr getProcessRuntimeCache(size_t capacity) {
+    static std::mutex mutex;
+    // the networks with different capacities do not evict each other's records
+    static std::map<size_t, std::weak_ptr<MultiCache>> processCaches;
+
+    std::lock_guard<std::mutex> lock{mutex};
+    for (auto it = processCaches.begin(); it != processCaches.end();) {
+        it = it->second.expired() ? processCaches.erase(it) : std::next(it);
+    }
+    auto cache = processCaches[capacity].lock();
+    if (!cache) {
+        cache = std::make_shared<MultiCache>(capacity, static_cast<size_t>(std::max(1, getNumberOfCPUCores())));
+        processCaches[capacity] = cache;
+    }
+    return cache;
+}
+}   // namespace
+
 struct ImmediateSerialExecutor : public ITaskExecutor {
     void run(InferenceEngine::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -123,6 +144,32 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+
+    switch (_cfg.rtCacheSharing) {
+    case Config::RuntimeCacheSharing::PerStream:
+        break;
+    case Config::RuntimeCacheSharing::PerNetwork:
+        _rtParamsSharedCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, static_cast<size_t>(streams));
+        break;
+    case Config::RuntimeCacheSharing::PerProcess:
+        _rtParamsSharedCache = getProcessRuntimeCache(_cfg.rtCacheCapacity);
+        break;
+    }
+    // only the stream shareable values go to the shared cache, each stream keeps the rest in a cache of its own
+    for (int i = 0; i < streams; i++)
+        _rtParamsCaches.push_back(std::make_shared<MultiCache>(_cfg.rtCacheCapacity, _rtParamsSharedCache));
+    if (_cfg.persistentWeightsCache && !_cfg.cache_dir.empty()) {
+        _persistentWeightsCache = std::make_shared<PersistentWeightsCache>(_cfg.cache_dir);
+    }
+    _numaMemoryTracker = std::make_shared<NumaMemoryTracker>();
+    // the graphs for the other input shapes are created on demand by the infer requests of the new API,
+    // the models with the states are not supported since the states are kept in the graphs
+    if (_cfg.shapeVariants && _cfg.isNewApi && !_cfg.batchLimit && !function->is_dynamic() &&
+        !ngraph::op::util::has_op_with_type<ov::op::util::ReadValueBase>(function)) {
+        _shapeVariants.resize(streams);
+    }
+    // every stream compiles a graph of its own, since the nodes keep per-graph state; the graphs have in common
+    // only the repacked weights and the folded constants of the weights cache and the shared runtime cache values
     if (_cfg.streamExecutorConfig._streams != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(_graphs.begin(), _graphs.end(), [&] (Graph& graph) {
@@ -173,30 +220,90 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
+    const auto graphIdx = streamId % _graphs.size();
+    auto graphLock = GraphGuard::Lock(_graphs[graphIdx]);
     if (!graphLock._graph.IsReady()) {
-        std::exception_ptr exception;
-        auto makeGraph = [&] {
-            try {
-                {
-                    std::lock_guard<std::mutex> lock{_cfgMutex};
-                    graphLock._graph.setConfig(_cfg);
-                }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
-            } catch(...) {
-                exception = std::current_exception();
-            }
-        };
-        if (nullptr != streamsExecutor) {
-            streamsExecutor->Execute(makeGraph);
+        BuildGraph(graphLock._graph, graphIdx, numaNodeId);
+    }
+    return graphLock;
+}
+
+std::shared_ptr<ExecNetwork::GraphGuard> ExecNetwork::GetShapeVariant(const std::map<std::string, VectorDims>& inputShapes) const {
+    if (inputShapes.empty() || _shapeVariants.empty())
+        return nullptr;
+
+    int streamId = 0;
+    int numaNodeId = 0;
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor) {
+        streamId = streamsExecutor->GetStreamId();
+        numaNodeId = streamsExecutor->GetNumaNodeId();
+    }
+    const auto graphIdx = streamId % _graphs.size();
+
+    std::shared_ptr<GraphGuard> variant;
+    {
+        std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+        auto& variants = _shapeVariants[graphIdx];
+        auto found = std::find_if(variants.begin(), variants.end(), [&](const ShapeVariants::value_type& item) {
+            return item.first == inputShapes;
+        });
+        if (found != variants.end()) {
+            variants.splice(variants.begin(), variants, found);
         } else {
-            makeGraph();
+            variants.emplace_front(inputShapes, std::make_shared<GraphGuard>());
+            // a released graph is destroyed by the last request using it
+            if (variants.size() > _cfg.shapeVariants)
+                variants.pop_back();
         }
-        if (exception) {
-            std::rethrow_exception(exception);
+        variant = variants.front().second;
+    }
+
+    auto graphLock = GraphGuard::Lock(*variant);
+    if (!graphLock._graph.IsReady()) {
+        // the model transformations and the weights are reused, the nodes keep the implementations and the layouts
+        // of the original graph, unless they are not applicable to the new shapes
+        auto selection = GetGraph()._graph.getNodesSelection();
+        const bool hasSelection = !selection.empty();
+        try {
+            graphLock._graph.setInputShapes(inputShapes, std::move(selection));
+            BuildGraph(graphLock._graph, graphIdx, numaNodeId);
+        } catch (const SelectionMismatch&) {
+            // the implementation or the layout selected for the model shapes doesn't fit the new ones
+            if (!hasSelection)
+                throw;
+            graphLock._graph.setInputShapes(inputShapes, {});
+            BuildGraph(graphLock._graph, graphIdx, numaNodeId);
         }
     }
-    return graphLock;
+    return variant;
+}
+
+void ExecNetwork::BuildGraph(GraphGuard& graph, size_t graphIdx, int numaNodeId) const {
+    std::exception_ptr exception;
+    auto makeGraph = [&] {
+        try {
+            {
+                std::lock_guard<std::mutex> lock{_cfgMutex};
+                graph.setConfig(_cfg);
+            }
+            graph.setRuntimeCache(_rtParamsCaches[graphIdx % _rtParamsCaches.size()]);
+            graph.setPersistentWeightsCache(_persistentWeightsCache);
+            graph.setNumaNode(numaNodeId, _numaMemoryTracker);
+            graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+        } catch(...) {
+            exception = std::current_exception();
+        }
+    };
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor) {
+        streamsExecutor->Execute(makeGraph);
+    } else {
+        makeGraph();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
 }
 
 void ExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -210,6 +317,15 @@ void ExecNetwork::setProperty(const std::map<std::string, std::string> &properti
             graphLock._graph.setProperty(properties);
         }
     }
+    std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+    for (auto& variants : _shapeVariants) {
+        for (auto& variant : variants) {
+            auto graphLock = GraphGuard::Lock(*variant.second);
+            if (graphLock._graph.IsReady()) {
+                graphLock._graph.setProperty(properties);
+            }
+        }
+    }
 }
 
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
@@ -280,6 +396,34 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_RUNTIME_CACHE_STATISTICS) {
+        // the lookups of the shared cache are counted by the stream caches of this network, since the process cache
+        // serves the other networks as well. Its evictions aren't attributed to any network, so they are reported
+        // only for the cache owned by the network
+        CacheStatistics statistics;
+        for (const auto& cache : _rtParamsCaches) {
+            statistics += cache->getStatistics();
+            statistics += cache->getSharedLookupStatistics();
+        }
+        if (_rtParamsSharedCache && _cfg.rtCacheSharing == Config::RuntimeCacheSharing::PerNetwork)
+            statistics.evictions += _rtParamsSharedCache->getStatistics().evictions;
+        return std::map<std::string, uint64_t>{
+            {"hits", statistics.hits},
+            {"misses", statistics.misses},
+            {"evictions", statistics.evictions}};
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_PERSISTENT_WEIGHTS_CACHE_STATISTICS) {
+        PersistentWeightsCache::Statistics statistics;
+        if (_persistentWeightsCache)
+            statistics = _persistentWeightsCache->getStatistics();
+        return std::map<std::string, uint64_t>{
+            {"restored", statistics.restored},
+            {"stored", statistics.stored}};
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_NUMA_MEMORY_STATISTICS) {
+        const auto statistics = _numaMemoryTracker->getStatistics();
+        return std::map<std::string, uint64_t>{
+            {"local_pages", statistics.localPages},
+            {"remote_pages", statistics.remotePages},
+            {"unknown_pages", statistics.unknownPages}};
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -544,7 +688,11 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 }
 
 void ExecNetwork::Export(std::ostream& modelStream) {
-    CNNNetworkSerializer serializer(modelStream, extensionManager);
+    std::map<std::string, Graph::NodeSelection> nodesSelection;
+    if (_cfg.exportCompiledGraph) {
+        nodesSelection = GetGraph()._graph.getNodesSelection();
+    }
+    CNNNetworkSerializer serializer(modelStream, extensionManager, std::move(nodesSelection));
     serializer <<_network;
 }
 
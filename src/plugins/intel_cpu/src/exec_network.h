@@ -11,6 +11,7 @@
 #include "extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <list>
 #include <vector>
 #include <memory>
 #include <map>
@@ -68,6 +69,17 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                           _numaNodesWeights;
+    // runtime parameters caches: one per graph, the stream shareable values go to the shared one if any
+    std::vector<MultiCachePtr>                  _rtParamsCaches;
+    MultiCachePtr                               _rtParamsSharedCache;
+    // on-disk storage of the repacked weights, shared by all the graphs, nullptr if disabled
+    PersistentWeightsCache::Ptr                 _persistentWeightsCache;
+    // NUMA placement of the graphs workspaces, for the debug metric
+    NumaMemoryTracker::Ptr                      _numaMemoryTracker;
+    // the graphs created for the other static input shapes, per stream, the most recently used first
+    using ShapeVariants = std::list<std::pair<std::map<std::string, VectorDims>, std::shared_ptr<GraphGuard>>>;
+    mutable std::vector<ShapeVariants>          _shapeVariants;
+    mutable std::mutex                          _shapeVariantsMutex;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -75,6 +87,14 @@ protected:
      */
     GraphGuard::Lock GetGraph() const;
 
+    /* Returns the graph of the current stream created for the static input shapes other than the model ones,
+     * nullptr if the shapes are empty. The least recently used graphs are released, so the returned pointer
+     * must outlive the graph lock.
+     */
+    std::shared_ptr<GraphGuard> GetShapeVariant(const std::map<std::string, VectorDims>& inputShapes) const;
+
+    void BuildGraph(GraphGuard& graph, size_t graphIdx, int numaNodeId) const;
+
     bool canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const;
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 
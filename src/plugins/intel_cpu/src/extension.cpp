@@ -55,6 +55,9 @@ std::map<std::string, ngraph::OpSet> Extension::getOpSets() {
         NGRAPH_OP(Convolution, ngraph::op::v1)
         NGRAPH_OP(ConvolutionBackpropData, ngraph::op::v1)
         NGRAPH_OP(DepthToSpace, ngraph::op::v0)
+        NGRAPH_OP(EmbeddingBagOffsetsSum, ngraph::op::v3)
+        NGRAPH_OP(EmbeddingBagPackedSum, ngraph::op::v3)
+        NGRAPH_OP(EmbeddingSegmentsSum, ngraph::op::v3)
         NGRAPH_OP(Equal, ngraph::op::v1)
         NGRAPH_OP(FakeQuantize, ngraph::op::v0)
         NGRAPH_OP(Greater, ngraph::op::v1)
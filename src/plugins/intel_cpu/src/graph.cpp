@@ -38,6 +38,7 @@
 #include "utils/debug_capabilities.h"
 #include "utils/node_dumper.h"
 #include "utils/ngraph_utils.hpp"
+#include "utils/rt_info/memory_formats_attribute.hpp"
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -57,6 +58,46 @@ using namespace InferenceEngine::details;
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+
+// the name of the activations memory format of the descriptor accepted by the memory formats runtime info,
+// empty if the descriptor has no such format
+std::string getMemoryFormatName(const MemoryDesc& desc) {
+    static const std::map<size_t, std::vector<const char*>> formats = {
+        {1, {"x"}},
+        {2, {"nc"}},
+        {3, {"ncw", "nwc", "nCw8c", "nCw16c"}},
+        {4, {"nchw", "nhwc", "nChw8c", "nChw16c"}},
+        {5, {"ncdhw", "ndhwc", "nCdhw8c", "nCdhw16c"}},
+    };
+
+    const auto rankFormats = formats.find(desc.getShape().getRank());
+    if (rankFormats == formats.end() || !desc.isDefined())
+        return {};
+
+    for (const auto* name : rankFormats->second) {
+        const DnnlBlockedMemoryDesc formatDesc(desc.getShape(), DnnlExtensionUtils::IEPrecisionToDataType(desc.getPrecision()),
+                                               dnnl::utils::str2fmt(name));
+        if (desc.isCompatible(formatDesc))
+            return name;
+    }
+    return {};
+}
+
+// the memory formats filter is positional, so only the leading ports with the known formats are listed
+std::string getMemoryFormatsValue(const std::vector<PortConfig>& ports, size_t maxPorts) {
+    std::string value;
+    for (size_t i = 0; i < std::min(ports.size(), maxPorts); i++) {
+        const auto name = getMemoryFormatName(*ports[i].getMemDesc());
+        if (name.empty())
+            break;
+        value += (value.empty() ? "cpu:" : ",cpu:") + name;
+    }
+    return value;
+}
+
+}   // namespace
+
 typedef std::unordered_set<EdgePtr> edge_cluster_t;
 typedef std::vector<edge_cluster_t> edge_clusters_t;
 
@@ -67,12 +108,14 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
         WeightsSharing::Ptr &w_cache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateGraph");
 
-    if (IsReady())
+    // the data may also be left by the failed creation attempt
+    if (IsReady() || !graphNodes.empty())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable weights caching if graph was created only once, unless the weights are restored from the persistent cache
+    // or shared with the graphs created for the other input shapes
+    weightsCache = config.streamExecutorConfig._streams != 1 || persistentWeightsCache || config.shapeVariants ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    rtParamsCache = sharedRtParamsCache ? sharedRtParamsCache : std::make_shared<MultiCache>(config.rtCacheCapacity);
 
     Replicate(net, extMgr);
     InitGraph();
@@ -91,7 +134,7 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
     // disable weights caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    rtParamsCache = sharedRtParamsCache ? sharedRtParamsCache : std::make_shared<MultiCache>(config.rtCacheCapacity);
 
     this->_name = std::move(name);
     this->reuse_io_tensors = false;
@@ -225,6 +268,23 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
         upperBoundModel->reshape(newInShape);
 
         func = upperBoundModel;
+    } else if (!variantInputShapes.empty()) {
+        auto variantModel = ngraph::clone_function(*network.getFunction());
+        std::map<ov::Output<ov::Node>, ov::PartialShape> newInShape;
+        for (const auto& in : variantModel->get_parameters()) {
+            const auto shape = variantInputShapes.find(in->get_friendly_name());
+            if (shape != variantInputShapes.end())
+                newInShape[in] = ov::PartialShape(ov::Shape(shape->second));
+        }
+        try {
+            variantModel->reshape(newInShape);
+        } catch (const ov::Exception& ex) {
+            IE_THROW() << "Can't create the graph for the input shapes other than the model ones: " << ex.what();
+        }
+
+        setNodesSelection(variantModel, variantSelection);
+
+        func = variantModel;
     } else {
         func = network.getFunction();
     }
@@ -374,6 +434,66 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
     }
 }
 
+std::map<std::string, Graph::NodeSelection> Graph::getNodesSelection() const {
+    std::map<std::string, NodeSelection> selection;
+    for (const auto& node : graphNodes) {
+        const auto* selectedPD = node->getSelectedPrimitiveDescriptor();
+        if (!selectedPD || one_of(node->getType(), Type::Input, Type::Output))
+            continue;
+
+        NodeSelection& nodeSelection = selection[node->getName()];
+        const auto implType = selectedPD->getImplementationType();
+        const auto priority = std::string("cpu:") + impl_type_to_string(implType);
+        if (implType != impl_desc_type::unknown && parse_impl_name(priority) == implType)
+            nodeSelection.primitivesPriority = priority;
+        // the convolutions filter only the data formats, the weights ones follow from them
+        const size_t maxPorts = one_of(node->getType(), Type::Convolution, Type::Deconvolution) ?
+            1 : std::numeric_limits<size_t>::max();
+        nodeSelection.inputMemoryFormats = getMemoryFormatsValue(selectedPD->getConfig().inConfs, maxPorts);
+        nodeSelection.outputMemoryFormats = getMemoryFormatsValue(selectedPD->getConfig().outConfs, maxPorts);
+    }
+    return selection;
+}
+
+Graph::ReplacedSelection Graph::setNodesSelection(const std::shared_ptr<ov::Model>& model,
+                                                  const std::map<std::string, NodeSelection>& selection) {
+    ReplacedSelection replaced;
+    for (const auto& op : model->get_ops()) {
+        const auto nodeSelection = selection.find(op->get_friendly_name());
+        if (nodeSelection == selection.end())
+            continue;
+        auto& rtInfo = op->get_rt_info();
+        ov::RTMap previous;
+        auto replace = [&](const std::string& key, ov::Any value) {
+            const auto it = rtInfo.find(key);
+            previous[key] = it != rtInfo.end() ? it->second : ov::Any();
+            rtInfo[key] = std::move(value);
+        };
+        const auto& nodeValues = nodeSelection->second;
+        if (!nodeValues.primitivesPriority.empty())
+            replace(ov::PrimitivesPriority::get_type_info_static(), ov::PrimitivesPriority(nodeValues.primitivesPriority));
+        if (!nodeValues.inputMemoryFormats.empty())
+            replace(InputMemoryFormats::get_type_info_static(), InputMemoryFormats(nodeValues.inputMemoryFormats));
+        if (!nodeValues.outputMemoryFormats.empty())
+            replace(OutputMemoryFormats::get_type_info_static(), OutputMemoryFormats(nodeValues.outputMemoryFormats));
+        if (!previous.empty())
+            replaced.emplace_back(op, std::move(previous));
+    }
+    return replaced;
+}
+
+void Graph::resetNodesSelection(const ReplacedSelection& replaced) {
+    for (const auto& op : replaced) {
+        auto& rtInfo = op.first->get_rt_info();
+        for (const auto& entry : op.second) {
+            if (entry.second.empty())
+                rtInfo.erase(entry.first);
+            else
+                rtInfo[entry.first] = entry.second;
+        }
+    }
+}
+
 void Graph::InitGraph() {
     GraphOptimizer optimizer;
 
@@ -392,6 +512,8 @@ void Graph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitExecutionLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -459,7 +581,65 @@ void Graph::ExtractConstantAndExecutableNodes() {
              */
             executableGraphNodes.emplace_back(graphNode);
         }
+        if (graphNode->getType() == Type::MemoryInput) {
+            memoryInputNodes.emplace_back(graphNode);
+        }
+    }
+
+    if (!execLevels.empty()) {
+        // execution by levels requires the memory plan built on the same levels (see AllocateWithReuse)
+        for (const auto& node : executableGraphNodes) {
+            const auto level = static_cast<size_t>(execLevels[node->execIndex]);
+            if (executableGraphLevels.size() <= level)
+                executableGraphLevels.resize(level + 1);
+            executableGraphLevels[level].push_back(node);
+        }
+        executableGraphLevels.erase(std::remove_if(executableGraphLevels.begin(), executableGraphLevels.end(),
+                                                   [](const std::vector<NodePtr>& level) { return level.empty(); }),
+                                    executableGraphLevels.end());
+    }
+}
+
+void Graph::InitExecutionLevels() {
+    execLevels.clear();
+    executableGraphLevels.clear();
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.interOpParallelism)
+        return;
+
+    // Nodes are executed concurrently only if they have no hidden data dependencies and
+    // don't touch the runtime cache during inference (dynamic nodes call prepareParams on the fly).
+    const bool isSupported = std::none_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->isDynamicNode() || one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput);
+    });
+    if (!isSupported)
+        return;
+
+    // graphNodes are sorted topologically, so all the parents are visited before the children
+    std::vector<int> levels(graphNodes.size(), 0);
+    std::vector<size_t> levelWidth(1, 0);
+    for (const auto& node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            level = std::max(level, levels[node->getParentEdgeAt(i)->getParent()->execIndex] + 1);
+        }
+        levels[node->execIndex] = level;
+
+        if (node->isConstant() || one_of(node->getType(), Type::Input, Type::Output))
+            continue;
+        if (levelWidth.size() <= static_cast<size_t>(level))
+            levelWidth.resize(level + 1, 0);
+        levelWidth[level]++;
     }
+
+    // the levels based memory plan is less compact, so don't use it for the graphs without independent branches
+    const bool hasIndependentBranches = std::any_of(levelWidth.begin(), levelWidth.end(), [](size_t width) {
+        return width > 1;
+    });
+    if (hasIndependentBranches)
+        execLevels = std::move(levels);
+#endif
 }
 
 void Graph::ExecuteConstantNodesOnly() const {
@@ -477,7 +657,7 @@ void Graph::ExecuteConstantNodesOnly() const {
             auto edgePtr = node->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = weightsCache->get(edgePtr->name());
+                    auto ptr = weightsCache->get(edgePtr->weightsCacheKey());
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -490,13 +670,74 @@ void Graph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // The constant nodes are traversed in the reverse order, so the consumers are visited first. A node is not executed
+    // if each its output is either restored from the persistent weights cache or consumed only by not executed nodes.
+    std::unordered_set<const Node*> restoredNodes;
+    std::unordered_map<const Node*, std::vector<std::pair<EdgePtr, std::string>>> entriesToStore;
+    if (weightsCache && persistentWeightsCache) {
+        for (auto it = constantGraphNodes.rbegin(); it != constantGraphNodes.rend(); ++it) {
+            const auto& node = *it;
+            std::vector<std::pair<EdgePtr, std::shared_ptr<const uint8_t>>> restoredEdges;
+            bool restored = !node->getChildEdges().empty();
+
+            for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+                auto edgePtr = node->getChildEdgeAt(i);
+                if (!edgePtr || !edgePtr->isUseExternalMemory()) {
+                    restored = false;
+                } else if (edgePtr->getChild()->isConstant()) {
+                    restored = restored && restoredNodes.count(edgePtr->getChild().get());
+                } else if (weightsCache->get(edgePtr->weightsCacheKey())->isValid()) {
+                    // another stream has already produced the output, so the source isn't hashed and looked up
+                    continue;
+                } else {
+                    const auto signature = PersistentWeightsCache::getSignature(edgePtr);
+                    if (signature.empty()) {
+                        restored = false;
+                        continue;
+                    }
+                    auto data = persistentWeightsCache->find(signature, edgePtr->getMemory().GetSize());
+                    if (data) {
+                        restoredEdges.emplace_back(edgePtr, data);
+                    } else {
+                        restored = false;
+                        entriesToStore[node.get()].emplace_back(edgePtr, signature);
+                    }
+                }
+            }
+
+            if (!restored)
+                continue;
+
+            for (const auto& restoredEdge : restoredEdges) {
+                const auto& edgePtr = restoredEdge.first;
+                auto sharedOutput = weightsCache->get(edgePtr->weightsCacheKey());
+                if (!sharedOutput->isValid()) {
+                    cpu_memcpy(edgePtr->getMemory().GetData(), restoredEdge.second.get(), edgePtr->getMemory().GetSize());
+                    sharedOutput->valid(true);
+                }
+            }
+            restoredNodes.insert(node.get());
+        }
+    }
+
     for (const auto &node : constantGraphNodes) {
         if (weightsCache) {
+            if (restoredNodes.count(node.get()))
+                continue;
+
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
                 ExecuteNode(node, stream);
 
+                auto entries = entriesToStore.find(node.get());
+                if (entries != entriesToStore.end()) {
+                    for (const auto& entry : entries->second) {
+                        const auto& memory = entry.first->getMemory();
+                        persistentWeightsCache->store(entry.second, memory.GetData(), memory.GetSize());
+                    }
+                }
+
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
             }
@@ -671,7 +912,7 @@ void Graph::AllocateWithReuse() {
                     auto constNode = std::static_pointer_cast<node::Input>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<Memory>(constNode->getMemoryPtr()));
                 } else {
-                    edge->externalAllocate(weightsCache);
+                    edge->externalAllocate(weightsCache, config.hugePages);
                 }
                 erase = true;
             }
@@ -696,6 +937,12 @@ void Graph::AllocateWithReuse() {
         for (auto &edge : edge_clusters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
+            // Nodes of the same level may run concurrently, so the lifetime of a tensor
+            // must cover the whole levels of its producer and consumer.
+            if (!execLevels.empty()) {
+                e_start = execLevels[e_start];
+                e_finish = execLevels[e_finish];
+            }
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
@@ -733,9 +980,22 @@ void Graph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
-    memWorkspace = std::make_shared<Memory>(eng);
+    memWorkspace = config.hugePages != HugePagesMode::Disabled
+                       ? std::make_shared<Memory>(eng, std::unique_ptr<IMemoryMngr>(new MemoryMngrWithHugePages(config.hugePages)))
+                       : std::make_shared<Memory>(eng);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
 
+    // The graph is created by the stream thread, but the pages are physically allocated by the first touch,
+    // which may happen anywhere. So with the NUMA binding the workspace (intermediate tensors and the internal
+    // copies of the inputs/outputs) is explicitly bound to the stream node and touched in advance.
+    if (numaNodeId >= 0 && total_size > 0 &&
+        config.streamExecutorConfig._threadBindingType == InferenceEngine::IStreamsExecutor::ThreadBindingType::NUMA) {
+        bindToNumaNode(memWorkspace->GetData(), total_size, numaNodeId);
+        firstTouch(memWorkspace->GetData(), total_size);
+    }
+    if (numaMemoryTracker && numaNodeId >= 0)
+        numaMemoryTracker->track(memWorkspace, numaNodeId);
+
     if (edge_clusters.empty())
         return;
 
@@ -763,6 +1023,48 @@ void Graph::AllocateWithReuse() {
     }
 }
 
+void Graph::AllocateDynamicWithArena() {
+    std::unordered_map<EdgePtr, std::pair<int, int>> lifetimes;  // root edge -> {start, finish}
+    std::unordered_set<EdgePtr> excluded;
+
+    for (auto& edge : graphEdges) {
+        auto root = edge;
+        while (auto sharedEdge = root->getSharedEdge(std::nothrow))
+            root = sharedEdge;
+
+        if (root->getStatus() != Edge::Status::NeedAllocation || root->hasDefinedMaxSize())
+            continue;
+
+        // the memory of graph inputs/outputs and states may be bound to the external buffers
+        // or must be preserved between inferences, so it is kept out of the shared workspace
+        const auto parent = edge->getParent();
+        const auto child = edge->getChild();
+        if (parent->isConstant() ||
+            one_of(parent->getType(), Type::Input, Type::MemoryInput) ||
+            one_of(child->getType(), Type::Output, Type::MemoryOutput)) {
+            excluded.insert(root);
+        }
+
+        auto it = lifetimes.find(root);
+        if (it == lifetimes.end()) {
+            lifetimes.emplace(root, std::make_pair(parent->execIndex, child->execIndex));
+        } else {
+            it->second.first = std::min(it->second.first, parent->execIndex);
+            it->second.second = std::max(it->second.second, child->execIndex);
+        }
+    }
+
+    for (auto& edge : graphEdges) {
+        auto it = lifetimes.find(edge);
+        if (it == lifetimes.end() || excluded.count(edge))
+            continue;
+
+        if (!dynamicMemoryArena)
+            dynamicMemoryArena = std::make_shared<DynamicMemoryArena>();
+        edge->allocate(dynamicMemoryArena->registerSlot(it->second.first, it->second.second));
+    }
+}
+
 void Graph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::Allocate");
 
@@ -774,6 +1076,10 @@ void Graph::Allocate() {
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
+    // Bind the edges with undefined memory upper bound to the dynamic shapes workspace
+    if (config.dynamicMemoryArena)
+        AllocateDynamicWithArena();
+
     // Create dummy memory with undefined desc for edges that are need allocation but has not been allocated withing mem solver
     for (auto& edge : graphEdges) edge->allocate();
 
@@ -960,6 +1266,25 @@ void Graph::Infer(InferRequestBase* request) {
 
     dnnl::stream stream(eng);
 
+    // The dynamic edges have been moved to the new workspace regions, so the nodes
+    // that cache memory pointers in prepareParams must be updated.
+    if (dynamicMemoryArena && dynamicMemoryArena->updatePlan()) {
+        for (const auto& node : executableGraphNodes) {
+            if (node->isDynamicNode())
+                node->resetLastInputDims();
+        }
+    }
+
+    if (executableGraphLevels.empty()) {
+        InferSequential(request, stream);
+    } else {
+        InferByLevels(request, stream);
+    }
+
+    if (infer_count != -1) infer_count++;
+}
+
+void Graph::InferSequential(InferRequestBase* request, const dnnl::stream& stream) {
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
         PERF(node, config.collectPerfCounters);
@@ -968,8 +1293,36 @@ void Graph::Infer(InferRequestBase* request) {
             request->ThrowIfCanceled();
         ExecuteNode(node, stream);
     }
+}
 
-    if (infer_count != -1) infer_count++;
+void Graph::InferByLevels(InferRequestBase* request, const dnnl::stream& stream) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    for (const auto& level : executableGraphLevels) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        if (level.size() == 1) {
+            const auto& node = level.front();
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            ExecuteNode(node, stream);
+            continue;
+        }
+
+        // the nodes of one level share the task arena of the current stream, so the nested
+        // parallel sections of each node are balanced by TBB within the stream thread budget
+        tbb::parallel_for(size_t(0), level.size(), [&](size_t i) {
+            const auto& node = level[i];
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            // dnnl stream is not thread safe, so use a separate one per concurrently executed node
+            dnnl::stream nodeStream(eng);
+            ExecuteNode(node, nodeStream);
+        });
+    }
+#else
+    InferSequential(request, stream);
+#endif
 }
 
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
@@ -10,7 +10,10 @@
 #include "normalize_preprocess.h"
 #include "node.h"
 #include "edge.h"
+#include "dynamic_memory_arena.h"
 #include "cache/multi_cache.h"
+#include "persistent_weights_cache.h"
+#include "numa_memory.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -49,6 +52,75 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @brief Sets the runtime parameters cache to be used by the graph nodes instead of the graph own one.
+     * Must be called before the graph creation.
+     */
+    void setRuntimeCache(MultiCachePtr cache) {
+        sharedRtParamsCache = std::move(cache);
+    }
+
+    /**
+     * @brief Sets the on-disk storage of the repacked constant weights. Must be called before the graph creation.
+     */
+    void setPersistentWeightsCache(PersistentWeightsCache::Ptr cache) {
+        persistentWeightsCache = std::move(cache);
+    }
+
+    /**
+     * @brief Sets the NUMA node of the stream owning the graph. With the NUMA threads binding the workspace
+     * is bound to this node, the tracker (optional) collects the workspace placement for the debug metric.
+     * Must be called before the graph creation.
+     */
+    void setNumaNode(int nodeId, NumaMemoryTracker::Ptr tracker) {
+        numaNodeId = nodeId;
+        numaMemoryTracker = std::move(tracker);
+    }
+
+    /**
+     * @brief The primitives selection of a node in the form of the runtime info of the operation it's created from
+     */
+    struct NodeSelection {
+        std::string primitivesPriority;
+        std::string inputMemoryFormats;
+        std::string outputMemoryFormats;
+    };
+
+    /**
+     * @brief Returns the implementation types and the memory formats selected for the nodes of the ready graph
+     */
+    std::map<std::string, NodeSelection> getNodesSelection() const;
+
+    /**
+     * @brief The primitives selection runtime info of the operations as it was before setNodesSelection replaced it.
+     * The entries absent before are empty.
+     */
+    using ReplacedSelection = std::vector<std::pair<std::shared_ptr<ov::Node>, ov::RTMap>>;
+
+    /**
+     * @brief Makes the nodes created from the operations of the model prefer the selected implementations and
+     * memory formats by setting the corresponding runtime info of the operations
+     * @return The replaced runtime info, to be restored by resetNodesSelection
+     */
+    static ReplacedSelection setNodesSelection(const std::shared_ptr<ov::Model>& model,
+                                               const std::map<std::string, NodeSelection>& selection);
+
+    /**
+     * @brief Removes the primitives selection runtime info set by setNodesSelection and restores the replaced one,
+     * the runtime info set by the user is kept
+     */
+    static void resetNodesSelection(const ReplacedSelection& replaced);
+
+    /**
+     * @brief Sets the static input shapes the graph is created for instead of the model ones. The model is reshaped
+     * on Replicate stage, the nodes found in the selection prefer the same implementations and memory formats.
+     * Must be called before the graph creation.
+     */
+    void setInputShapes(std::map<std::string, VectorDims> shapes, std::map<std::string, NodeSelection> selection) {
+        variantInputShapes = std::move(shapes);
+        variantSelection = std::move(selection);
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
@@ -106,6 +178,13 @@ public:
         return output->second;
     }
 
+    /**
+     * @brief Returns the MemoryInput nodes, which keep the variable states of the graph
+     */
+    const std::vector<NodePtr>& GetMemoryInputNodes() const {
+        return memoryInputNodes;
+    }
+
     bool hasOutputWithName(const std::string& name) const {
         return outputNodesMap.count(name);
     }
@@ -204,7 +283,13 @@ protected:
         outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
+        constantGraphNodes.clear();
+        executableGraphNodes.clear();
+        memoryInputNodes.clear();
         _normalizePreprocMap.clear();
+        execLevels.clear();
+        executableGraphLevels.clear();
+        dynamicMemoryArena.reset();
     }
     Status status { NotReady };
     Config config;
@@ -216,6 +301,7 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    DynamicMemoryArena::Ptr dynamicMemoryArena;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -237,9 +323,13 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void AllocateDynamicWithArena();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
+    void InitExecutionLevels();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
+    void InferSequential(InferRequestBase* request, const dnnl::stream& stream);
+    void InferByLevels(InferRequestBase* request, const dnnl::stream& stream);
     void ExecuteConstantNodesOnly() const;
 
     friend class LegacyInferRequest;
@@ -257,8 +347,26 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> constantGraphNodes;
     std::vector<NodePtr> executableGraphNodes;
+    // the MemoryInput nodes, to bind the variable states of the infer request without scanning the whole graph
+    std::vector<NodePtr> memoryInputNodes;
+
+    // Inter-op parallelism: execLevels[node->execIndex] is the wavefront the node belongs to
+    // (longest path from the graph inputs). Nodes of the same level don't depend on each other
+    // and may be executed concurrently. Empty when the graph is executed strictly sequentially.
+    std::vector<int> execLevels;
+    std::vector<std::vector<NodePtr>> executableGraphLevels;
 
     MultiCachePtr rtParamsCache;
+    MultiCachePtr sharedRtParamsCache;
+    PersistentWeightsCache::Ptr persistentWeightsCache;
+
+    // -1 if the NUMA node of the owning stream is unknown
+    int numaNodeId = -1;
+    NumaMemoryTracker::Ptr numaMemoryTracker;
+
+    // empty if the graph is created for the model input shapes
+    std::map<std::string, VectorDims> variantInputShapes;
+    std::map<std::string, NodeSelection> variantSelection;
 
     void EnforceBF16();
 };
@@ -20,6 +20,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/embedding_bag_sum.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -73,6 +74,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     MergeConvertAndScaleShift(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDequantization");
+    FuseEmbeddingBagAndDequantization(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseDeconvolutionAndSimpleOperation");
     FuseDeconvolutionAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -536,6 +541,83 @@ void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndDequantization(Graph& graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableEmbeddingNode = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::EmbeddingBagOffsetsSum, Type::EmbeddingBagPackedSum, Type::EmbeddingSegmentsSum) &&
+               node->getOriginalInputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    auto isQuantizedTable = [](const NodePtr& node) {
+        return node->getType() == Type::Input && node->isConstant() &&
+               one_of(node->getOriginalOutputPrecisionAtPort(0), Precision::I8, Precision::U8);
+    };
+
+    auto isSingleOrRowScales = [](const VectorDims& scalesDims, const VectorDims& tableDims) {
+        const auto isOne = [](Dim dim) { return dim == 1; };
+        if (std::all_of(scalesDims.begin(), scalesDims.end(), isOne))
+            return true;
+        return scalesDims.size() == tableDims.size() && scalesDims[0] == tableDims[0] &&
+               std::all_of(scalesDims.begin() + 1, scalesDims.end(), isOne);
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto embedding = graphNodes[i];
+        if (!isSuitableEmbeddingNode(embedding))
+            continue;
+
+        auto dequantization = embedding->getParentEdgesAtPort(0)[0]->getParent();
+        if (dequantization->getType() != Type::Eltwise || dequantization->getChildEdges().size() != 1 ||
+            !dequantization->getFusedWith().empty() || !dequantization->getOutputShapeAtPort(0).isStatic())
+            continue;
+        const auto& tableDims = dequantization->getOutputShapeAtPort(0).getStaticDims();
+
+        // The table is dequantized by the scale only:
+        // Input [i8/u8] -> Convert -> [f32] -> Multiply by the single scale or the scales of the rows
+        // Input [i8/u8] -> PowerStatic with the merged Convert
+        NodePtr table, convert;
+        EdgePtr scalesEdge;
+        if (dequantization->getAlgorithm() == Algorithm::EltwisePowerStatic) {
+            const auto power = std::dynamic_pointer_cast<Eltwise>(dequantization);
+            if (!power || power->getAlpha() != 1.0f || power->getGamma() != 0.0f)
+                continue;
+            table = dequantization->getParentEdgesAtPort(0)[0]->getParent();
+        } else if (dequantization->getAlgorithm() == Algorithm::EltwiseMultiply && dequantization->getParentEdges().size() == 2) {
+            const size_t dataPort = dequantization->getParentEdgesAtPort(0)[0]->getParent()->getType() == Type::Convert ? 0 : 1;
+            convert = dequantization->getParentEdgesAtPort(dataPort)[0]->getParent();
+            scalesEdge = dequantization->getParentEdgesAtPort(1 - dataPort)[0];
+            const auto scales = scalesEdge->getParent();
+            if (convert->getType() != Type::Convert || convert->getChildEdges().size() != 1 ||
+                convert->getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+                scales->getType() != Type::Input || !scales->isConstant() || scales->getChildEdges().size() != 1 ||
+                dequantization->getInputShapeAtPort(dataPort).getDims() != tableDims ||
+                !isSingleOrRowScales(dequantization->getInputShapeAtPort(1 - dataPort).getDims(), tableDims))
+                continue;
+            table = convert->getParentEdgesAtPort(0)[0]->getParent();
+        } else {
+            continue;
+        }
+        if (!isQuantizedTable(table))
+            continue;
+
+        auto embeddingBag = std::dynamic_pointer_cast<node::EmbeddingBagSum>(embedding);
+        if (!embeddingBag)
+            IE_THROW() << "Cannot cast " << embedding->getName() << " to EmbeddingBagSum";
+        embeddingBag->setTableScales(dequantization->getScalesAndShifts(convert ? convert.get() : table.get()).first);
+
+        if (scalesEdge)
+            graph.RemoveEdge(scalesEdge);
+        graph.DropNode(dequantization);
+        embedding->addOriginalLayer(dequantization->getOriginalLayers());
+        if (convert) {
+            graph.DropNode(convert);
+            embedding->addOriginalLayer(convert->getOriginalLayers());
+        }
+        embedding->setOriginalInputPrecisionAtPort(0, table->getOriginalOutputPrecisionAtPort(0));
+    }
+}
+
 void GraphOptimizer::FuseConvolutionAndZeroPoints(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
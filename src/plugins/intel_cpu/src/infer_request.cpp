@@ -56,7 +56,9 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            auto state = std::make_shared<VariableState>(state_name, state_store);
+            variableStates[memoryNode->getId()] = state;
+            memoryStates.emplace_back(state);
         }
     }
 }
@@ -92,46 +94,29 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
-void InferRequestBase::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
+void InferRequestBase::bindStates() {
+    for (const auto& node : graph->GetMemoryInputNodes()) {
+        auto memoryNode = dynamic_cast<node::MemoryInput*>(node.get());
+        if (!memoryNode) {
+            IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
+        }
+        auto state = variableStates.find(memoryNode->getId());
+        if (state != variableStates.end()) {
+            memoryNode->bindState(state->second->getReadBuffer(), state->second->getWriteBuffer());
         }
     }
 }
 
-void InferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+void InferRequestBase::swapStates() {
+    for (const auto& node : graph->GetMemoryInputNodes()) {
+        auto memoryNode = dynamic_cast<node::MemoryInput*>(node.get());
+        if (!memoryNode) {
+            IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
+        }
+        // the state without Assign keeps its value
+        auto state = variableStates.find(memoryNode->getId());
+        if (state != variableStates.end() && memoryNode->hasOutputNode()) {
+            state->second->swapBuffers();
         }
     }
 }
@@ -152,8 +137,17 @@ void InferRequestBase::redefineMemoryForInputNodes() {
 void InferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    std::map<std::string, VectorDims> variantInputShapes;
+    {
+        // the graph of the previous inference may be used by another request, so it is read under the lock
+        auto streamGraphLock = execNetwork->GetGraph();
+        graph = &(streamGraphLock._graph);
+        variantInputShapes = getVariantInputShapes();
+    }
+    auto shapeVariant = execNetwork->GetShapeVariant(variantInputShapes);
+    auto graphLock = shapeVariant ? ExecNetwork::GraphGuard::Lock(*shapeVariant) : execNetwork->GetGraph();
     graph = &(graphLock._graph);
+    shapeVariantGraph = shapeVariant;
 
     ThrowIfCanceled();
     convertBatchedInputBlobs();
@@ -167,20 +161,46 @@ void InferRequestBase::InferImpl() {
 
     execDataPreprocessing(_inputs);
 
-    changeDefaultPtr();
+    // the graphs created for the other input shapes are always fed by copy
+    if (!shapeVariant) {
+        // the input blobs might have been reallocated by setShape while the other input shapes were inferred
+        if (graph->getProperty().shapeVariants) {
+            for (auto& ptr : externalPtr) {
+                const auto input = _inputs.find(ptr.first);
+                if (input != _inputs.end())
+                    ptr.second = input->second->buffer();
+            }
+            // the bound output blobs were reshaped by the inferences with the other input shapes, so they get the
+            // graph output shapes back before the graph writes to them. The released buffers are not written to
+            for (const auto& output : _outputs) {
+                auto ptr = externalPtr.find(output.first);
+                const auto outputNode = graph->outputNodesMap.find(output.first);
+                if (ptr == externalPtr.end() || _inputs.count(output.first) || outputNode == graph->outputNodesMap.end())
+                    continue;
+                const auto& dims = outputNode->second->getParentEdgesAtPort(0)[0]->getMemory().getStaticDims();
+                if (output.second->getTensorDesc().getDims() != dims)
+                    output.second->setShape(dims);
+                ptr->second = output.second->buffer();
+            }
+        }
+        changeDefaultPtr();
+    }
+
+    bindOutputsMemory();
 
     ThrowIfCanceled();
 
     PushInputData();
 
-    if (memoryStates.size() != 0) {
-        PushStates();
+    // the graph works with the states of the request in place, the written ones become current after the inference
+    if (!variableStates.empty()) {
+        bindStates();
     }
 
     graph->Infer(this);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
+    if (!variableStates.empty()) {
+        swapStates();
     }
 
     ThrowIfCanceled();
@@ -699,13 +719,16 @@ void InferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob:
 
         const auto shape = inputNodeItr->second->get_output_partial_shape(0);
         const bool isDynamic = shape.is_dynamic();
-        if (!shape.compatible(ov::PartialShape(data->getTensorDesc().getDims()))) {
+        // the static model is inferred with the other input shapes of the same rank by the separate graphs
+        const bool isShapeVariant = !isDynamic && graph->getProperty().shapeVariants &&
+                                    shape.rank().get_length() == data->getTensorDesc().getDims().size();
+        if (!isShapeVariant && !shape.compatible(ov::PartialShape(data->getTensorDesc().getDims()))) {
             IE_THROW() << "Can't set input blob with name: " << name
                        << ", because model input (shape=" << shape
                        << ") and blob (shape=" << vec2str(data->getTensorDesc().getDims()) << ") are incompatible";
         }
 
-        if (!isDynamic && ngraph::shape_size(shape.to_shape()) != data->size()) {
+        if (!isDynamic && !isShapeVariant && ngraph::shape_size(shape.to_shape()) != data->size()) {
             IE_THROW() << "Can't set input blob with name: " << name << ", because model input size = " << ngraph::shape_size(shape.to_shape())
                        << " and blob size = " << data->size() << " are different.";
         }
@@ -873,6 +896,80 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
     return data;
 }
 
+std::map<std::string, VectorDims> InferRequest::getVariantInputShapes() const {
+    std::map<std::string, VectorDims> inputShapes;
+    if (!graph->getProperty().shapeVariants)
+        return inputShapes;
+
+    bool isModelShapes = true;
+    for (const auto& input : modelInputsMap) {
+        const auto& shape = input.second->get_output_partial_shape(0);
+        const auto blob = _inputs.find(input.first);
+        if (shape.is_dynamic() || blob == _inputs.end())
+            return {};
+        const auto& dims = blob->second->getTensorDesc().getDims();
+        isModelShapes = isModelShapes && dims == shape.to_shape();
+        inputShapes[input.first] = dims;
+    }
+    return isModelShapes ? std::map<std::string, VectorDims>{} : inputShapes;
+}
+
+void InferRequest::bindOutputsMemory() {
+    if (!graph->getProperty().zeroCopyOutputs || graph->getProperty().batchLimit)
+        return;
+
+    for (const auto& output : _outputs) {
+        const auto& name = output.first;
+        const auto outputNode = graph->outputNodesMap.find(name);
+        if (outputNode == graph->outputNodesMap.end())
+            continue;
+
+        // the producing node must own its output memory exclusively, so it can be placed anywhere
+        const auto parentEdge = outputNode->second->getParentEdgeAt(0);
+        const auto parent = parentEdge->getParent();
+        if (!parent->isDynamicNode() || parent->isConstant() || parent->isInPlace() ||
+            parent->getChildEdges().size() != 1 || parentEdge->getStatus() != Edge::Status::Allocated)
+            continue;
+
+        auto& memory = parentEdge->getMemory();
+        const auto& desc = memory.getDesc();
+        auto memMngr = memory.getDnnlMemoryMngr();
+        if (!memMngr || !desc.hasLayoutType(LayoutType::ncsp))
+            continue;
+
+        auto blob = std::dynamic_pointer_cast<InferenceEngine::MemoryBlob>(output.second);
+        const auto rank = desc.getShape().getRank();
+        const bool canBind = blob && blob->getTensorDesc().getPrecision() == desc.getPrecision() &&
+                             rank > 0 && blob->getTensorDesc().getDims().size() == rank &&
+                             blob->getTensorDesc().getLayout() == InferenceEngine::TensorDesc::getLayoutByRank(rank);
+
+        // the memory size of the previous inference is the best guess for the current one
+        const size_t required = desc.isDefined() ? memory.GetSize() : 0;
+        // the blob may have been shrunk or reallocated at the same address, only its current size is reliable
+        const size_t capacity = canBind ? blob->byteSize() : 0;
+        void* data = required > 0 && capacity >= required ? blob->buffer().as<void*>() : nullptr;
+
+        // the graph is shared by the requests, so the memory may be bound to a blob of another one
+        void* bound = memMngr->hasExtBuffer() ? memMngr->getRawPtr() : nullptr;
+        if (data && data == bound) {
+            memMngr->setExtBuff(data, capacity);
+            continue;
+        }
+        if (!data && !bound)
+            continue;
+
+        // the node might have cached the pointer of the previous memory, e.g. Split
+        parent->resetLastInputDims();
+        if (data) {
+            memMngr->setExtBuff(data, capacity);
+        } else {
+            // the graph must not write to the blob of the previous inference, the result will be copied
+            memMngr->setExtBuff(nullptr, 0);
+            memMngr->resize(required);
+        }
+    }
+}
+
 void InferRequest::PushInputData() {
     for (auto input : _inputs) {
         auto inputName = input.first;
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace ov {
@@ -15,6 +16,7 @@ namespace intel_cpu {
 
 class ExecNetwork;
 class AsyncInferRequest;
+class VariableState;
 
 class InferRequestBase : public InferenceEngine::IInferRequestInternal {
 public:
@@ -54,19 +56,32 @@ protected:
 
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
+    /**
+     * @brief Binds the output blobs memory to the graph before the inference, if it's supported by the request
+     */
+    virtual void bindOutputsMemory() {}
+    /**
+     * @brief Returns the static input shapes if they differ from the model ones and the graph must be created for them,
+     * otherwise an empty map
+     */
+    virtual std::map<std::string, VectorDims> getVariantInputShapes() const { return {}; }
 
     Graph* graph = nullptr;
+    // keeps the graph created for the other input shapes alive, while the request refers to it
+    std::shared_ptr<Graph> shapeVariantGraph;
     std::unordered_map<std::string, void*> externalPtr;
 
 private:
-    void PushStates();
-    void PullStates();
+    void bindStates();
+    void swapStates();
     void redefineMemoryForInputNodes();
 
     void changeDefaultPtr();
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    // the states by the ids of the MemoryInput nodes
+    std::unordered_map<std::string, std::shared_ptr<VariableState>> variableStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
 };
 
@@ -99,6 +114,8 @@ private:
     void PushInputData() override;
     void initBlobs() override;
     void SetBatch(int batch = -1) override;
+    void bindOutputsMemory() override;
+    std::map<std::string, VectorDims> getVariantInputShapes() const override;
 
     std::unordered_map<std::string, std::shared_ptr<const ov::Node>> modelInputsMap;
     std::unordered_map<std::string, std::shared_ptr<const ov::Node>> modelOutputsMap;
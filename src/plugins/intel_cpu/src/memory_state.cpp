@@ -11,10 +11,35 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, MemoryPtr storage)
+    : InferenceEngine::IVariableStateInternal{name} {
+    for (auto& buffer : buffers) {
+        buffer = std::make_shared<Memory>(storage->getEngine());
+        buffer->Create(storage->getDesc());
+    }
+    cpu_memcpy(getReadBuffer()->GetData(), storage->GetData(), storage->GetSize());
+
+    // the blob is filled only when the state is requested
+    state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
+    state->allocate();
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    getReadBuffer()->FillZero();
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    const auto& buffer = getReadBuffer();
+    if (!newState || newState->byteSize() != buffer->GetSize())
+        IE_THROW() << "Cannot set the state " << name << ": the new state has different size";
+    cpu_memcpy(buffer->GetData(), newState->cbuffer().as<const void*>(), buffer->GetSize());
+}
+
+Blob::CPtr VariableState::GetState() const {
+    const auto& buffer = getReadBuffer();
+    cpu_memcpy(state->buffer(), buffer->GetData(), buffer->GetSize());
+    return state;
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -10,21 +10,41 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The variable state is kept in two buffers: the graph reads the current state from one of them and writes the
+ * new state into the other one, then the buffers are swapped. So the state isn't copied between the inferences, it's
+ * copied only when the user gets or sets it.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    VariableState(std::string name, MemoryPtr storage);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    const MemoryPtr& getReadBuffer() const {
+        return buffers[readIdx];
+    }
+    const MemoryPtr& getWriteBuffer() const {
+        return buffers[readIdx ^ 1];
+    }
+    /**
+     * @brief Makes the new state written by the inference current
+     */
+    void swapBuffers() {
+        readIdx ^= 1;
+    }
+
+private:
+    std::array<MemoryPtr, 2> buffers;
+    size_t readIdx = 0;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compress_embedding_table.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph_ops/type_relaxed.hpp>
+
+#include "itt.hpp"
+
+NGRAPH_RTTI_DEFINITION(ov::intel_cpu::CompressEmbeddingTable, "CompressEmbeddingTable", 0);
+
+namespace {
+
+template <class T>
+std::shared_ptr<ngraph::Node> relaxTableType(const std::shared_ptr<ngraph::Node>& node) {
+    const auto casted = std::dynamic_pointer_cast<T>(node);
+    if (!casted)
+        return nullptr;
+    // the embedding is validated with the fp32 table
+    return std::make_shared<ngraph::op::TypeRelaxed<T>>(*casted,
+                                                        ngraph::element::TypeVector{ngraph::element::f32},
+                                                        ngraph::element::TypeVector{ngraph::element::f32});
+}
+
+}  // namespace
+
+ov::intel_cpu::CompressEmbeddingTable::CompressEmbeddingTable() {
+    MATCHER_SCOPE(CompressEmbeddingTable);
+    auto embedding_m = ngraph::pattern::wrap_type<ngraph::opset3::EmbeddingBagOffsetsSum,
+                                                  ngraph::opset3::EmbeddingBagPackedSum,
+                                                  ngraph::opset3::EmbeddingSegmentsSum>();
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto embedding = m.get_match_root();
+        if (std::dynamic_pointer_cast<ngraph::op::TypeRelaxedBase>(embedding))
+            return false;
+
+        const auto table = std::dynamic_pointer_cast<ngraph::opset1::Constant>(embedding->get_input_node_shared_ptr(0));
+        if (!table || table->get_element_type() != ngraph::element::f32)
+            return false;
+
+        // the values are kept as they are, so the compression doesn't change the result
+        const auto size = ngraph::shape_size(table->get_shape());
+        const auto values = table->get_data_ptr<float>();
+        std::vector<ngraph::float16> compressed(size);
+        for (size_t i = 0; i < size; i++) {
+            compressed[i] = ngraph::float16(values[i]);
+            if (static_cast<float>(compressed[i]) != values[i])
+                return false;
+        }
+
+        auto newTable = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f16, table->get_shape(), compressed.data());
+        newTable->set_friendly_name(table->get_friendly_name());
+        ngraph::copy_runtime_info(table, newTable);
+
+        std::shared_ptr<ngraph::Node> newEmbedding = relaxTableType<ngraph::opset3::EmbeddingBagOffsetsSum>(embedding);
+        if (!newEmbedding)
+            newEmbedding = relaxTableType<ngraph::opset3::EmbeddingBagPackedSum>(embedding);
+        if (!newEmbedding)
+            newEmbedding = relaxTableType<ngraph::opset3::EmbeddingSegmentsSum>(embedding);
+        if (!newEmbedding)
+            return false;
+
+        newEmbedding->input(0).replace_source_output(newTable);
+        newEmbedding->validate_and_infer_types();
+        newEmbedding->set_friendly_name(embedding->get_friendly_name());
+        ngraph::copy_runtime_info(embedding, newEmbedding);
+        ngraph::replace_node(embedding, newEmbedding);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(embedding_m, matcher_name);
+    this->register_matcher(m, callback);
+}
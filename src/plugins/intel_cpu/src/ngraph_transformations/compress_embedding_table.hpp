@@ -0,0 +1,20 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+// The fp32 constant embedding table, which is exact in fp16, is stored in fp16. The embedding keeps the fp32 output.
+class CompressEmbeddingTable : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    CompressEmbeddingTable();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_embedding_table_dequantization.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "itt.hpp"
+
+NGRAPH_RTTI_DEFINITION(ov::intel_cpu::MarkEmbeddingTableDequantization, "MarkEmbeddingTableDequantization", 0);
+
+ov::intel_cpu::MarkEmbeddingTableDequantization::MarkEmbeddingTableDequantization() {
+    MATCHER_SCOPE(MarkEmbeddingTableDequantization);
+    ngraph::element::TypeVector table_precisions{ ngraph::element::i8, ngraph::element::u8 };
+    auto table_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any(table_precisions));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({table_m}, ngraph::pattern::type_matches(ngraph::element::f32));
+    auto scale_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({convert_m, scale_m});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        // Constant -> [i8/u8] -> Convert -> [f32] -> Multiply(scale) -> [f32] -> Embedding table
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+        const auto multiply = pattern_map.at(multiply_m).get_node_shared_ptr();
+        if (multiply->get_output_partial_shape(0) != convert->get_output_partial_shape(0))
+            return false;
+
+        const auto consumers = multiply->get_output_target_inputs(0);
+        if (consumers.size() != 1 || consumers.begin()->get_index() != 0)
+            return false;
+        const auto embedding = consumers.begin()->get_node();
+        if (!ngraph::is_type<ngraph::opset3::EmbeddingBagOffsetsSum>(embedding) &&
+            !ngraph::is_type<ngraph::opset3::EmbeddingBagPackedSum>(embedding) &&
+            !ngraph::is_type<ngraph::opset3::EmbeddingSegmentsSum>(embedding))
+            return false;
+
+        ov::disable_constant_folding(convert);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(multiply_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+// Keeps the int8 embedding table, which is dequantized by the scale only, from being folded to fp32,
+// so the embedding node reads the int8 table and dequantizes its rows while it accumulates them.
+class MarkEmbeddingTableDequantization : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkEmbeddingTableDequantization();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
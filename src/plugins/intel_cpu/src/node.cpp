@@ -135,7 +135,7 @@ Node::Node(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, Wei
             implPriorities.push_back(parse_impl_name(str));
             if (implPriorities[implPriorities.size() - 1] == impl_desc_type::unknown &&
                 str != "cpu:unknown")
-                IE_THROW() << "Unsupported CPU implementation " << str << " for node " << getName();
+                throw SelectionMismatch("Unsupported CPU implementation " + str + " for node " + getName());
         }
     }
 
@@ -613,11 +613,12 @@ void Node::filterSupportedPrimitiveDescriptors() {
     };
 
     if (!inputMemoryFormatsFilter.empty() || !outputMemoryFormatsFilter.empty()) {
+        const bool hadDescriptors = !supportedPrimitiveDescriptors.empty();
         auto itpd = supportedPrimitiveDescriptors.begin();
         while (itpd != supportedPrimitiveDescriptors.end()) {
             const auto &config = itpd->getConfig();
             if (inputMemoryFormatsFilter.size() > config.inConfs.size() || outputMemoryFormatsFilter.size() > config.outConfs.size())
-                IE_THROW() << "Incorrect number of input or output memory formats";
+                throw SelectionMismatch("Incorrect number of input or output memory formats for node " + getName());
 
             bool isSuitableDesc = true;
             for (int i = 0; i < inputMemoryFormatsFilter.size(); i++) {
@@ -634,6 +635,9 @@ void Node::filterSupportedPrimitiveDescriptors() {
                 itpd++;
             }
         }
+        if (hadDescriptors && supportedPrimitiveDescriptors.empty())
+            throw SelectionMismatch("None of the supported primitive descriptors of node " + getName() +
+                                    " has the requested memory formats");
     }
 }
 
@@ -1507,21 +1511,41 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<Shape>& shapes
     return shapeInferGeneric(input_shapes, input_value_port_mask);
 }
 
-std::vector<VectorDims> Node::shapeInferGeneric(uint32_t input_value_port_mask) const {
-    std::vector<StaticShape> input_shapes;
-    const auto & iranks = shapeInference->get_input_ranks();
+namespace {
+// the memory of the node input edges read by the shape inference in place
+class EdgeShapeInferInputs : public IShapeInferInputs {
+public:
+    explicit EdgeShapeInferInputs(const Node& node) : node(node) {}
 
-    input_shapes.reserve(iranks.size());
+    const VectorDims& get_dims(size_t port) const override {
+        return getMemory(port).getStaticDims();
+    }
 
-    for (size_t port = 0; port < iranks.size(); port++) {
-        if (iranks[port] == 0) {
-            input_shapes.emplace_back();
-        } else {
-            input_shapes.emplace_back(getParentEdgesAtPort(port)[0]->getMemory().getStaticDims());
+    ov::element::Type get_element_type(size_t port) const override {
+        return InferenceEngine::details::convertPrecision(getMemory(port).getDesc().getPrecision());
+    }
+
+    const void* get_data(size_t port) const override {
+        return getMemory(port).GetPtr();
+    }
+
+private:
+    // unlike getParentEdgesAtPort, doesn't collect the edges to a vector
+    const Memory& getMemory(size_t port) const {
+        for (const auto& edge_w : node.getParentEdges()) {
+            auto edge = edge_w.lock();
+            if (edge && static_cast<size_t>(edge->getOutputNum()) == port)
+                return edge->getMemory();
         }
+        IE_THROW() << "Node " << node.getName() << " has no parent edge at port " << port;
     }
 
-    return shapeInferGeneric(input_shapes, input_value_port_mask);
+    const Node& node;
+};
+}   // namespace
+
+const std::vector<VectorDims>& Node::shapeInferGeneric(uint32_t input_value_port_mask) const {
+    return shapeInference->infer(EdgeShapeInferInputs(*this), input_value_port_mask);
 }
 
 void Node::updateLastInputDims() {
@@ -41,6 +41,15 @@ using NodePtr = std::shared_ptr<Node>;
 using NodeConstPtr = std::shared_ptr<const Node>;
 using NodeWeakPtr = std::weak_ptr<Node>;
 
+/**
+ * @brief Thrown when the implementation or the memory formats requested for the node by the runtime info of its
+ * operation don't fit the node, e.g. the selection stored along with the network by another build of the plugin
+ */
+class SelectionMismatch : public InferenceEngine::Exception {
+public:
+    using InferenceEngine::Exception::Exception;
+};
+
 class PortConfigurator {
 public:
     PortConfigurator(ov::intel_cpu::LayoutType blockedDescType, InferenceEngine::Precision prc, const Shape& shape,
@@ -333,6 +342,14 @@ public:
     void executeDynamic(dnnl::stream strm);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
 
+    /**
+     * @brief Forces shape inference and params preparation on the next dynamic execution.
+     * Must be called when the memory of the node edges has been moved without the shapes change.
+     */
+    void resetLastInputDims() {
+        lastInputDims.clear();
+    }
+
     virtual void initSupportedPrimitiveDescriptors();
 
     /**
@@ -722,7 +739,11 @@ protected:
     bool inputShapesModified() const;
     virtual bool needShapeInfer() const;
     std::vector<VectorDims> shapeInferGeneric(const std::vector<Shape>& inputDims, uint32_t value_port_mask = 0) const;
-    std::vector<VectorDims> shapeInferGeneric(uint32_t value_port_mask = 0) const;
+    /**
+     * @brief Infers the output shapes from the memory of the input edges, which is compared with the memoized inputs in
+     * place, so a repeated input allocates nothing. The returned shapes are valid until the next shape inference.
+     */
+    const std::vector<VectorDims>& shapeInferGeneric(uint32_t value_port_mask = 0) const;
     virtual std::vector<VectorDims> shapeInfer() const;
     // TODO [DS] : make pure after all nodes will be support dynamic shapes
     virtual void executeDynamicImpl(dnnl::stream strm) {
@@ -742,7 +763,7 @@ protected:
 
     std::vector<VectorDims> lastInputDims = {};
 
-    std::shared_ptr<IShapeInfer> shapeInference;
+    std::shared_ptr<IMemoizedShapeInfer> shapeInference;
 
 private:
     std::vector<EdgeWeakPtr> parentEdges;
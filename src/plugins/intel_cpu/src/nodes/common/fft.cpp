@@ -0,0 +1,259 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft.h"
+#include "cpu_memcpy.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr double PI = 3.141592653589793238462643;
+
+// DFT of the odd prime length R: the symmetric pairs of the inputs share the cosine and sine terms
+template <size_t R>
+inline void butterfly(float* re, float* im, const float* cs, const float* sn) {
+    constexpr size_t half = R / 2;
+    float sumRe[half], sumIm[half], diffRe[half], diffIm[half];
+    float outRe[R], outIm[R];
+    outRe[0] = re[0];
+    outIm[0] = im[0];
+    for (size_t q = 0; q < half; q++) {
+        sumRe[q] = re[q + 1] + re[R - 1 - q];
+        sumIm[q] = im[q + 1] + im[R - 1 - q];
+        diffRe[q] = re[q + 1] - re[R - 1 - q];
+        diffIm[q] = im[q + 1] - im[R - 1 - q];
+        outRe[0] += sumRe[q];
+        outIm[0] += sumIm[q];
+    }
+    for (size_t k = 1; k <= half; k++) {
+        float cosRe = re[0], cosIm = im[0], sinRe = 0.f, sinIm = 0.f;
+        for (size_t q = 0; q < half; q++) {
+            const size_t idx = ((q + 1) * k) % R;
+            cosRe += cs[idx] * sumRe[q];
+            cosIm += cs[idx] * sumIm[q];
+            sinRe += sn[idx] * diffRe[q];
+            sinIm += sn[idx] * diffIm[q];
+        }
+        outRe[k] = cosRe + sinIm;
+        outIm[k] = cosIm - sinRe;
+        outRe[R - k] = cosRe - sinIm;
+        outIm[R - k] = cosIm + sinRe;
+    }
+    for (size_t k = 0; k < R; k++) {
+        re[k] = outRe[k];
+        im[k] = outIm[k];
+    }
+}
+
+template <>
+inline void butterfly<2>(float* re, float* im, const float*, const float*) {
+    const float re0 = re[0], im0 = im[0];
+    re[0] = re0 + re[1];
+    im[0] = im0 + im[1];
+    re[1] = re0 - re[1];
+    im[1] = im0 - im[1];
+}
+
+template <>
+inline void butterfly<4>(float* re, float* im, const float*, const float*) {
+    const float re0 = re[0] + re[2], im0 = im[0] + im[2];
+    const float re1 = re[0] - re[2], im1 = im[0] - im[2];
+    const float re2 = re[1] + re[3], im2 = im[1] + im[3];
+    const float re3 = re[1] - re[3], im3 = im[1] - im[3];
+    re[0] = re0 + re2;
+    im[0] = im0 + im2;
+    re[1] = re1 + im3;
+    im[1] = im1 - re3;
+    re[2] = re0 - re2;
+    im[2] = im0 - im2;
+    re[3] = re1 - im3;
+    im[3] = im1 + re3;
+}
+
+/*
+    Stockham autosort pass: combines R sub-transforms of the length subLength into the sub-transforms of the length
+    subLength * R, the output is in the natural order after the last pass, so no bit reversal is required.
+    The inner loop goes over the contiguous points of the neighbouring sub-transforms.
+*/
+template <size_t R>
+void stockhamPass(const float* srcRe, const float* srcIm, float* dstRe, float* dstIm,
+                  size_t length, size_t subLength, const float* twiddlesRe, const float* twiddlesIm) {
+    float cs[R], sn[R];
+    for (size_t i = 0; i < R; i++) {
+        cs[i] = static_cast<float>(std::cos(2.0 * PI * i / R));
+        sn[i] = static_cast<float>(std::sin(2.0 * PI * i / R));
+    }
+
+    const size_t stride = length / R;
+    for (size_t first = 0; first < stride; first += subLength) {
+        float* outRe = dstRe + first * R;
+        float* outIm = dstIm + first * R;
+        for (size_t k = 0; k < subLength; k++) {
+            float re[R], im[R];
+            re[0] = srcRe[first + k];
+            im[0] = srcIm[first + k];
+            for (size_t r = 1; r < R; r++) {
+                const float xRe = srcRe[first + k + r * stride];
+                const float xIm = srcIm[first + k + r * stride];
+                const float wRe = twiddlesRe[(r - 1) * subLength + k];
+                const float wIm = twiddlesIm[(r - 1) * subLength + k];
+                re[r] = xRe * wRe - xIm * wIm;
+                im[r] = xRe * wIm + xIm * wRe;
+            }
+            butterfly<R>(re, im, cs, sn);
+            for (size_t r = 0; r < R; r++) {
+                outRe[k + r * subLength] = re[r];
+                outIm[k + r * subLength] = im[r];
+            }
+        }
+    }
+}
+
+} // namespace
+
+FFTExecutor::FFTExecutor(size_t length, bool inverse) : length(length), inverse(inverse) {
+    size_t rest = length;
+    size_t subLength = 1;
+    for (size_t radix : {4, 2, 3, 5, 7}) {
+        while (rest > 1 && rest % radix == 0) {
+            passes.push_back({radix, subLength, twiddlesRe.size()});
+            for (size_t r = 1; r < radix; r++) {
+                for (size_t k = 0; k < subLength; k++) {
+                    const double angle = -2.0 * PI * static_cast<double>(r * k) / static_cast<double>(subLength * radix);
+                    twiddlesRe.push_back(static_cast<float>(std::cos(angle)));
+                    twiddlesIm.push_back(static_cast<float>(std::sin(angle)));
+                }
+            }
+            subLength *= radix;
+            rest /= radix;
+        }
+    }
+    if (rest <= 1)
+        return;
+
+    // Bluestein's algorithm: nk = (n^2 + k^2 - (k - n)^2) / 2 turns the DFT into the circular convolution
+    // of the power of two length, which is computed by the mixed radix transforms
+    passes.clear();
+    twiddlesRe.clear();
+    twiddlesIm.clear();
+
+    size_t convolutionLength = 1;
+    while (convolutionLength < 2 * length - 1)
+        convolutionLength *= 2;
+    convolution.reset(new FFTExecutor(convolutionLength, false));
+
+    chirpRe.resize(length);
+    chirpIm.resize(length);
+    filterRe.assign(convolutionLength, 0.f);
+    filterIm.assign(convolutionLength, 0.f);
+    for (size_t n = 0; n < length; n++) {
+        // n^2 is taken by the modulo 2 * length to keep the precision of the phase for the long signals
+        const double angle = PI * static_cast<double>((n * n) % (2 * length)) / static_cast<double>(length);
+        chirpRe[n] = static_cast<float>(std::cos(angle));
+        chirpIm[n] = static_cast<float>(-std::sin(angle));
+        filterRe[n] = chirpRe[n];
+        filterIm[n] = -chirpIm[n];
+        if (n != 0) {
+            filterRe[convolutionLength - n] = chirpRe[n];
+            filterIm[convolutionLength - n] = -chirpIm[n];
+        }
+    }
+    std::vector<float> buffer(convolution->getBufferSize());
+    convolution->forward(filterRe.data(), filterIm.data(), buffer.data());
+    const float scale = 1.f / static_cast<float>(convolutionLength);
+    for (size_t m = 0; m < convolutionLength; m++) {
+        filterRe[m] *= scale;
+        filterIm[m] *= scale;
+    }
+}
+
+size_t FFTExecutor::getBufferSize() const {
+    return 2 * length + (convolution ? 4 * convolution->length : 2 * length);
+}
+
+void FFTExecutor::execute(float* data, float* buffer) const {
+    float* re = buffer;
+    float* im = buffer + length;
+    // the inverse transform through the forward one: ifft(x) = conj(fft(conj(x))) / length
+    const float sign = inverse ? -1.f : 1.f;
+    for (size_t i = 0; i < length; i++) {
+        re[i] = data[2 * i];
+        im[i] = sign * data[2 * i + 1];
+    }
+
+    forward(re, im, buffer + 2 * length);
+
+    const float scale = inverse ? 1.f / static_cast<float>(length) : 1.f;
+    for (size_t i = 0; i < length; i++) {
+        data[2 * i] = scale * re[i];
+        data[2 * i + 1] = sign * scale * im[i];
+    }
+}
+
+void FFTExecutor::forward(float* re, float* im, float* buffer) const {
+    if (convolution) {
+        bluestein(re, im, buffer);
+        return;
+    }
+
+    float* srcRe = re;
+    float* srcIm = im;
+    float* dstRe = buffer;
+    float* dstIm = buffer + length;
+    for (const auto& pass : passes) {
+        const float* passTwiddlesRe = twiddlesRe.data() + pass.twiddlesOffset;
+        const float* passTwiddlesIm = twiddlesIm.data() + pass.twiddlesOffset;
+        switch (pass.radix) {
+            case 2: stockhamPass<2>(srcRe, srcIm, dstRe, dstIm, length, pass.subLength, passTwiddlesRe, passTwiddlesIm); break;
+            case 3: stockhamPass<3>(srcRe, srcIm, dstRe, dstIm, length, pass.subLength, passTwiddlesRe, passTwiddlesIm); break;
+            case 4: stockhamPass<4>(srcRe, srcIm, dstRe, dstIm, length, pass.subLength, passTwiddlesRe, passTwiddlesIm); break;
+            case 5: stockhamPass<5>(srcRe, srcIm, dstRe, dstIm, length, pass.subLength, passTwiddlesRe, passTwiddlesIm); break;
+            case 7: stockhamPass<7>(srcRe, srcIm, dstRe, dstIm, length, pass.subLength, passTwiddlesRe, passTwiddlesIm); break;
+            default: break;
+        }
+        std::swap(srcRe, dstRe);
+        std::swap(srcIm, dstIm);
+    }
+    if (srcRe != re) {
+        cpu_memcpy(re, srcRe, length * sizeof(float));
+        cpu_memcpy(im, srcIm, length * sizeof(float));
+    }
+}
+
+void FFTExecutor::bluestein(float* re, float* im, float* buffer) const {
+    const size_t convolutionLength = convolution->length;
+    float* convRe = buffer;
+    float* convIm = buffer + convolutionLength;
+    float* convBuffer = buffer + 2 * convolutionLength;
+
+    for (size_t n = 0; n < length; n++) {
+        convRe[n] = re[n] * chirpRe[n] - im[n] * chirpIm[n];
+        convIm[n] = re[n] * chirpIm[n] + im[n] * chirpRe[n];
+    }
+    std::fill(convRe + length, convRe + convolutionLength, 0.f);
+    std::fill(convIm + length, convIm + convolutionLength, 0.f);
+
+    convolution->forward(convRe, convIm, convBuffer);
+    // the product is conjugated, so the next forward transform gives the conjugated inverse one
+    for (size_t m = 0; m < convolutionLength; m++) {
+        const float prodRe = convRe[m] * filterRe[m] - convIm[m] * filterIm[m];
+        const float prodIm = convRe[m] * filterIm[m] + convIm[m] * filterRe[m];
+        convRe[m] = prodRe;
+        convIm[m] = -prodIm;
+    }
+    convolution->forward(convRe, convIm, convBuffer);
+
+    for (size_t k = 0; k < length; k++) {
+        re[k] = convRe[k] * chirpRe[k] + convIm[k] * chirpIm[k];
+        im[k] = convRe[k] * chirpIm[k] - convIm[k] * chirpRe[k];
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Complex DFT of the fixed length over the interleaved (real, imaginary) data.
+ * The lengths which are the products of 2, 3, 5 and 7 are computed by the mixed radix Stockham passes
+ * of the radices 4, 2, 3, 5 and 7 (the factors of 4 go first, a single radix-2 pass takes the odd power of two),
+ * the other lengths go through Bluestein's algorithm over the power of two length.
+ * Only O(N) twiddle factors are kept, the passes work on the split real/imaginary arrays,
+ * so the butterflies of the neighbouring sub-transforms are vectorized by the compiler.
+ */
+class FFTExecutor {
+public:
+    FFTExecutor(size_t length, bool inverse);
+
+    // the number of floats of the scratch buffer for execute()
+    size_t getBufferSize() const;
+    // in-place transform of 'length' complex numbers, the inverse transform is normalized by the length
+    void execute(float* data, float* buffer) const;
+
+    size_t getLength() const {
+        return length;
+    }
+
+private:
+    struct Pass {
+        size_t radix;
+        size_t subLength;   // the length of the sub-transforms combined by the pass
+        size_t twiddlesOffset;
+    };
+
+    // the forward unnormalized transform of the split data, the result is placed back to re/im
+    void forward(float* re, float* im, float* buffer) const;
+    void bluestein(float* re, float* im, float* buffer) const;
+
+    size_t length;
+    bool inverse;
+
+    std::vector<Pass> passes;
+    std::vector<float> twiddlesRe;
+    std::vector<float> twiddlesIm;
+
+    // Bluestein's algorithm: the chirp and the spectrum of the chirp filter scaled by 1 / convolutionLength
+    std::unique_ptr<FFTExecutor> convolution;
+    std::vector<float> chirpRe;
+    std::vector<float> chirpIm;
+    std::vector<float> filterRe;
+    std::vector<float> filterIm;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
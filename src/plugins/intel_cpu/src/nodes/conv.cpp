@@ -888,7 +888,7 @@ void Convolution::filterSupportedPrimitiveDescriptors() {
 void Convolution::filterSupportedDescriptors() {
     if (!inputMemoryFormatsFilter.empty() || !outputMemoryFormatsFilter.empty()) {
         if (inputMemoryFormatsFilter.size() > 1 || outputMemoryFormatsFilter.size() > 1) {
-            IE_THROW() << "Incorrect number of input or output memory formats for Convolution node";
+            throw SelectionMismatch("Incorrect number of input or output memory formats for Convolution node " + getName());
         }
         auto itd = descs.begin();
         while (itd != descs.end()) {
@@ -376,7 +376,7 @@ void Deconvolution::filterSupportedPrimitiveDescriptors() {
 void Deconvolution::filterSupportedDescriptors() {
     if (!inputMemoryFormatsFilter.empty() || !outputMemoryFormatsFilter.empty()) {
         if (inputMemoryFormatsFilter.size() > 1 || outputMemoryFormatsFilter.size() > 1) {
-            IE_THROW() << "Incorrect number of input or output memory formats for Deconvolution node";
+            throw SelectionMismatch("Incorrect number of input or output memory formats for Deconvolution node " + getName());
         }
         auto itd = descs.begin();
         while (itd != descs.end()) {
@@ -243,9 +243,9 @@ void DFT::execute(dnnl::stream strm) {
     outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
+        // power of two lengths go through FFT, the other ones through the executors with O(N) twiddles
+        if (fftExecutors.find(nComplex) == fftExecutors.end() && !IsPowerOfTwo(nComplex)) {
+            fftExecutors[nComplex] = std::make_shared<FFTExecutor>(nComplex, inverse);
         }
     }
 
@@ -269,7 +269,9 @@ void DFT::execute(dnnl::stream strm) {
         if (IsPowerOfTwo(nComplex)) {
             fft(output, nComplex * 2, true);
         } else {
-            naiveDFT(output, nComplex * 2);
+            const auto& executor = *fftExecutors.at(nComplex);
+            std::vector<float> buffer(executor.getBufferSize());
+            executor.execute(output, buffer.data());
         }
     } else {
         dftNd(output, outputStrides);
@@ -284,28 +286,26 @@ void DFT::dftNd(float* output, const std::vector<size_t>& outputStrides) const {
         const size_t outputComplexLen = outputShape[currentAxis];
         const size_t outputLen = outputComplexLen * 2;
 
+        const FFTExecutor* executor = IsPowerOfTwo(outputComplexLen) ? nullptr : fftExecutors.at(outputComplexLen).get();
+        const size_t bufferSize = executor ? executor->getBufferSize() : 0;
+
         std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
-            size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
-            do {
-                parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen);
-                    auto parallelIterationCounter = iterationCounter;
-                    parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
+        size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
+        do {
+            parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
+                std::vector<float> gatheredData(outputLen + bufferSize);
+                auto parallelIterationCounter = iterationCounter;
+                parallelIterationCounter[parallelDimIndex] = dim;
+                gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
+                if (executor) {
+                    executor->execute(gatheredData.data(), gatheredData.data() + outputLen);
+                } else {
                     fft(gatheredData.data(), outputLen);
-                    applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                });
-                iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        }
+                }
+                applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
+            });
+            iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
+        } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
     }
 }
 
@@ -371,52 +371,6 @@ void DFT::fft(float* data, int64_t dataLength, bool parallelize) const {
     }
 }
 
-void DFT::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
-        for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
-            }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
-        }
-
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
-        }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
-}
-
-std::vector<std::pair<float, float>> DFT::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
-        }
-    });
-    return twiddles;
-}
-
 bool DFT::created() const {
     return getType() == Type::DFT;
 }
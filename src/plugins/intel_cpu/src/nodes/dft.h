@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include <node.h>
 #include <string>
+#include "common/fft.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -28,11 +29,9 @@ public:
 private:
     void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
     void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
 
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
-
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    // mixed radix / Bluestein transforms for the lengths which are not powers of two
+    std::unordered_map<size_t, std::shared_ptr<FFTExecutor>> fftExecutors;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
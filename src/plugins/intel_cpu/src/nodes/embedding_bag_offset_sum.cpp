@@ -49,9 +49,9 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
     static const std::set<Precision> supportedPrecisions =
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
+    // the bf16, fp16 and dequantized tables are read as is
+    const auto tablePrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    const auto inDataPrecision = getAccumulationPrecision(tablePrecision);
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -62,7 +62,7 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32}});
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
@@ -70,7 +70,12 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, getImplType(tablePrecision));
+}
+
+void EmbeddingBagOffsetSum::createPrimitive() {
+    createKernel(getSelectedPrimitiveDescriptor()->getConfig().inConfs[EMB_TABLE_IDX].getMemDesc()->getPrecision());
+    Node::createPrimitive();
 }
 
 void EmbeddingBagOffsetSum::prepareParams() {
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -9,9 +10,17 @@
 #include "ie_parallel.hpp"
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
+#include <openvino/core/type/float16.hpp>
 #include "common/cpu_memcpy.h"
+#include <cpu/x64/jit_generator.hpp>
+#include "utils/bfloat16.hpp"
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_embedding_bag, field)
 
 namespace ov {
 namespace intel_cpu {
@@ -46,72 +55,332 @@ void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
-template<typename T>
-void EmbeddingBagSum::processData(const T* srcData, const T* weightsData, T* dstData,
+namespace {
+// the rows of the random indices are rarely cached, so they are prefetched ahead of their accumulation
+constexpr size_t prefetchDistance = 4lu;
+constexpr size_t cacheLineSize = 64lu;
+
+// the compilers without the prefetch builtin just don't prefetch
+template<typename TTable>
+inline void prefetchRow(const TTable* table, size_t depth, int index) {
+#if defined(__GNUC__) || defined(__clang__)
+    const auto* row = reinterpret_cast<const char*>(table + index * depth);
+    for (size_t offset = 0lu; offset < depth * sizeof(TTable); offset += cacheLineSize)
+        __builtin_prefetch(row + offset, 0, 3);
+#endif
+}
+
+// the accumulation in the integer types, the integer tables aren't dequantized in it
+template<typename T, typename TTable>
+void accumulateBag(T* dst, const TTable* table, size_t depth, const int* indices, size_t size, const T* weights,
+                   const std::vector<float>&, const jit_uni_embedding_bag_kernel*) {
+    for (size_t inIdx = 1lu; inIdx < std::min(size, prefetchDistance); inIdx++)
+        prefetchRow(table, depth, indices[inIdx]);
+
+    for (size_t inIdx = 0lu; inIdx < size; inIdx++) {
+        if (inIdx + prefetchDistance < size)
+            prefetchRow(table, depth, indices[inIdx + prefetchDistance]);
+
+        const TTable* src = table + indices[inIdx] * depth;
+        if (weights) {
+            const T weight = weights[inIdx];
+            if (inIdx == 0lu) {
+                for (size_t i = 0lu; i < depth; i++)
+                    dst[i] = static_cast<T>(src[i]) * weight;
+            } else {
+                for (size_t i = 0lu; i < depth; i++)
+                    dst[i] += static_cast<T>(src[i]) * weight;
+            }
+        } else {
+            if (inIdx == 0lu) {
+                for (size_t i = 0lu; i < depth; i++)
+                    dst[i] = static_cast<T>(src[i]);
+            } else {
+                for (size_t i = 0lu; i < depth; i++)
+                    dst[i] += static_cast<T>(src[i]);
+            }
+        }
+    }
+}
+
+// the fp32 accumulation, which dequantizes the rows and is done by the kernel if the isa allows it
+template<typename TTable>
+void accumulateBag(float* dst, const TTable* table, size_t depth, const int* indices, size_t size, const float* weights,
+                   const std::vector<float>& scales, const jit_uni_embedding_bag_kernel* kernel) {
+    for (size_t inIdx = 1lu; inIdx < std::min(size, prefetchDistance); inIdx++)
+        prefetchRow(table, depth, indices[inIdx]);
+
+    for (size_t inIdx = 0lu; inIdx < size; inIdx++) {
+        if (inIdx + prefetchDistance < size)
+            prefetchRow(table, depth, indices[inIdx + prefetchDistance]);
+
+        const int index = indices[inIdx];
+        float weight = weights ? weights[inIdx] : 1.f;
+        if (!scales.empty())
+            weight *= scales[scales.size() == 1lu ? 0lu : index];
+
+        const TTable* src = table + index * depth;
+        if (kernel) {
+            jit_args_embedding_bag args;
+            args.src = src;
+            args.dst = dst;
+            args.work_amount = depth;
+            args.weight = weight;
+            args.accumulate = inIdx != 0lu;
+            (*kernel)(&args);
+        } else if (inIdx == 0lu) {
+            for (size_t i = 0lu; i < depth; i++)
+                dst[i] = static_cast<float>(src[i]) * weight;
+        } else {
+            for (size_t i = 0lu; i < depth; i++)
+                dst[i] += static_cast<float>(src[i]) * weight;
+        }
+    }
+}
+
+bool isKernelSupported(const Precision& tablePrecision, const Precision& accumulationPrecision) {
+    if (accumulationPrecision != Precision::FP32)
+        return false;
+    if (tablePrecision == Precision::FP16 && !dnnl::impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C))
+        return false;
+    return mayiuse(avx2);
+}
+}  // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_embedding_bag_kernel_f32 : public jit_uni_embedding_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_kernel_f32)
+
+    explicit jit_uni_embedding_bag_kernel_f32(jit_embedding_bag_config_params jcp)
+        : jit_uni_embedding_bag_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_accumulate, ptr[reg_params + GET_OFF(accumulate)]);
+        uni_vbroadcastss(vmm_weight, ptr[reg_params + GET_OFF(weight)]);
+
+        Xbyak::Label store_label;
+        Xbyak::Label exit_label;
+
+        // the first row of the bag overwrites the output row, the next ones are added to it
+        cmp(reg_accumulate, 0);
+        je(store_label, T_NEAR);
+        compute_row(true);
+        jmp(exit_label, T_NEAR);
+
+        L(store_label);
+        compute_row(false);
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_accumulate = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(0);
+    Xbyak::Xmm xmm_src = Xbyak::Xmm(0);
+    Vmm vmm_dst = Vmm(1);
+    Xbyak::Xmm xmm_dst = Xbyak::Xmm(1);
+    Vmm vmm_weight = Vmm(2);
+    Xbyak::Xmm xmm_weight = Xbyak::Xmm(2);
+
+    jit_embedding_bag_config_params jcp_;
+
+    inline void compute_row(bool accumulate) {
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        int step = vlen / sizeof(float);
+        L(main_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            load_vector(vmm_src, ptr[reg_src]);
+            uni_vmulps(vmm_src, vmm_src, vmm_weight);
+            if (accumulate)
+                uni_vaddps(vmm_src, vmm_src, ptr[reg_dst]);
+            uni_vmovups(ptr[reg_dst], vmm_src);
+
+            add(reg_src, step * jcp_.table_data_size);
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        step = 1;
+        L(tail_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(exit_label, T_NEAR);
+
+            load_scalar(xmm_src, ptr[reg_src]);
+            uni_vmulss(xmm_src, xmm_src, xmm_weight);
+            if (accumulate) {
+                uni_vmovss(xmm_dst, ptr[reg_dst]);
+                uni_vaddss(xmm_src, xmm_src, xmm_dst);
+            }
+            uni_vmovss(ptr[reg_dst], xmm_src);
+
+            add(reg_src, step * jcp_.table_data_size);
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+    }
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op) {
+        switch (jcp_.table_dt) {
+            case Precision::FP32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case Precision::BF16:
+                uni_vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
+            case Precision::FP16:
+                vcvtph2ps(vmm_src, op);
+                break;
+            case Precision::I8:
+                uni_vpmovsxbd(vmm_src, op);
+                uni_vcvtdq2ps(vmm_src, vmm_src);
+                break;
+            case Precision::U8:
+                uni_vpmovzxbd(vmm_src, op);
+                uni_vcvtdq2ps(vmm_src, vmm_src);
+                break;
+            default:
+                assert(!"unknown table_dt");
+        }
+    }
+
+    inline void load_scalar(Xbyak::Xmm xmm_src, const Xbyak::Address &op) {
+        switch (jcp_.table_dt) {
+            case Precision::FP32:
+                uni_vmovss(xmm_src, op);
+                break;
+            case Precision::BF16:
+                uni_vpinsrw(xmm_src, xmm_src, op, 0x0);
+                uni_vpslld(xmm_src, xmm_src, 16);
+                break;
+            case Precision::FP16:
+                uni_vpinsrw(xmm_src, xmm_src, op, 0x0);
+                vcvtph2ps(xmm_src, xmm_src);
+                break;
+            case Precision::I8:
+                uni_vpinsrb(xmm_src, xmm_src, op, 0x0);
+                uni_vpmovsxbd(xmm_src, xmm_src);
+                uni_vcvtdq2ps(xmm_src, xmm_src);
+                break;
+            case Precision::U8:
+                uni_vpinsrb(xmm_src, xmm_src, op, 0x0);
+                uni_vpmovzxbd(xmm_src, xmm_src);
+                uni_vcvtdq2ps(xmm_src, xmm_src);
+                break;
+            default:
+                assert(!"unknown table_dt");
+        }
+    }
+};
+
+Precision EmbeddingBagSum::getAccumulationPrecision(const Precision& tablePrecision) const {
+    if (tablePrecision == Precision::BF16 || tablePrecision == Precision::FP16 || !_tableScales.empty())
+        return Precision::FP32;
+    return tablePrecision;
+}
+
+impl_desc_type EmbeddingBagSum::getImplType(const Precision& tablePrecision) const {
+    if (!isKernelSupported(tablePrecision, getAccumulationPrecision(tablePrecision)))
+        return impl_desc_type::ref_any;
+    return mayiuse(x64::avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+}
+
+void EmbeddingBagSum::createKernel(const Precision& tablePrecision) {
+    _kernel.reset();
+    if (!isKernelSupported(tablePrecision, getAccumulationPrecision(tablePrecision)))
+        return;
+
+    jit_embedding_bag_config_params jcp;
+    jcp.table_dt = tablePrecision;
+    jcp.table_data_size = tablePrecision.size();
+
+    if (mayiuse(x64::avx512_common)) {
+        _kernel.reset(new jit_uni_embedding_bag_kernel_f32<x64::avx512_common>(jcp));
+    } else {
+        _kernel.reset(new jit_uni_embedding_bag_kernel_f32<x64::avx2>(jcp));
+    }
+    _kernel->create_ker();
+}
+
+template<typename T, typename TTable>
+void EmbeddingBagSum::processData(const TTable* srcData, const T* weightsData, T* dstData,
                                   const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
     initFromInputs();
 
     const size_t outputBagsNum = outDataDims[0];
+    const size_t tableSize = inDataDims[0];
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
+    _bags.resize(outputBagsNum);
+    _bagsRowsBegin.resize(outputBagsNum);
+    size_t rowsNum = 0lu;
+    for (size_t obi = 0lu; obi < outputBagsNum; obi++) {
+        auto& bag = _bags[obi];
+        bag = {nullptr, 0lu, 0, _withWeights};
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        if (bag.indices == nullptr)
+            bag.size = 0lu;
+        bag.withWeights = bag.withWeights && _withWeights;
+
+        _bagsRowsBegin[obi] = rowsNum;
+        // the empty bag still costs the fill of its output
+        rowsNum += std::max<size_t>(bag.size, 1lu);
+    }
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t rowsStart(0lu), rowsEnd(0lu);
+        splitter(rowsNum, nthr, ithr, rowsStart, rowsEnd);
+        // the thread takes the bags beginning in its share of the rows
+        const auto bagsBegin = _bagsRowsBegin.begin();
+        const size_t start = std::lower_bound(bagsBegin, _bagsRowsBegin.end(), rowsStart) - bagsBegin;
+        const size_t end = std::lower_bound(bagsBegin, _bagsRowsBegin.end(), rowsEnd) - bagsBegin;
 
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                }
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
+            const auto& bag = _bags[obi];
+            T* dst = dstData + obi * _embDepth;
+            if (bag.size == 0lu) {
+                std::fill_n(dst, _embDepth, static_cast<T>(0));
+                continue;
             }
+
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                if (static_cast<size_t>(bag.indices[inIdx]) >= tableSize)
+                    IE_THROW() << msgPrefix << "has invalid embedding bag index: " << bag.indices[inIdx];
+            }
+            accumulateBag(dst, srcData, _embDepth, bag.indices, bag.size,
+                          bag.withWeights ? weightsData + bag.weightsIdx : nullptr, _tableScales, _kernel.get());
         }
     };
 
@@ -125,11 +394,28 @@ void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
                     reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), inDims, outDims);
         }
+        case Precision::BF16: {
+            return processData<float, bfloat16_t>(reinterpret_cast<const bfloat16_t*>(srcData),
+                    reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), inDims, outDims);
+        }
+        case Precision::FP16: {
+            return processData<float, ov::float16>(reinterpret_cast<const ov::float16*>(srcData),
+                    reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), inDims, outDims);
+        }
         case Precision::I8: {
+            if (!_tableScales.empty()) {
+                return processData<float, int8_t>(reinterpret_cast<const int8_t*>(srcData),
+                        reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData),
+                        inDims, outDims);
+            }
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), inDims, outDims);
         }
         case Precision::U8: {
+            if (!_tableScales.empty()) {
+                return processData<float, uint8_t>(srcData, reinterpret_cast<const float*>(weightsData),
+                        reinterpret_cast<float*>(dstData), inDims, outDims);
+            }
             return processData<PrecisionTrait<Precision::U8>::value_type>(srcData, weightsData, dstData, inDims, outDims);
         }
         case Precision::I32: {
@@ -14,6 +14,32 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_args_embedding_bag {
+    const void* src;
+    float* dst;
+    size_t work_amount;
+    // the per sample weight times the scale of the row
+    float weight;
+    size_t accumulate;
+};
+
+struct jit_embedding_bag_config_params {
+    InferenceEngine::Precision table_dt;
+    unsigned table_data_size = 0;
+};
+
+// multiplies the table row by the weight and stores or adds it to the fp32 output row
+struct jit_uni_embedding_bag_kernel {
+    void (*ker_)(const jit_args_embedding_bag *);
+
+    void operator()(const jit_args_embedding_bag *args) const { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    jit_uni_embedding_bag_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_embedding_bag_kernel() {}
+};
+
 class EmbeddingBagSum {
 public:
     EmbeddingBagSum(
@@ -26,6 +52,11 @@ public:
     void execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                  const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims);
 
+    // the quantized table is dequantized by the single scale or by the scales of its rows while it's accumulated
+    void setTableScales(std::vector<float> scales) {
+        _tableScales = std::move(scales);
+    }
+
     ~EmbeddingBagSum() = default;
 
 protected:
@@ -39,8 +70,14 @@ protected:
 
     void prepareParams(const VectorDims& indexStaticShape);
 
-    template<typename T>
-    void processData(const T* srcData, const T* weightsData, T* dstData,
+    // the bf16, fp16 and dequantized tables are accumulated in fp32, the weights and the output are fp32 as well
+    InferenceEngine::Precision getAccumulationPrecision(const InferenceEngine::Precision& tablePrecision) const;
+    impl_desc_type getImplType(const InferenceEngine::Precision& tablePrecision) const;
+    void createKernel(const InferenceEngine::Precision& tablePrecision);
+
+    // the table rows of TTable type are accumulated in T, which is also the type of the weights and the output
+    template<typename T, typename TTable = T>
+    void processData(const TTable* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
 
     const size_t EMB_TABLE_IDX = 0lu;
@@ -51,6 +88,20 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+private:
+    struct Bag {
+        const int* indices;
+        size_t size;
+        int weightsIdx;
+        bool withWeights;
+    };
+    // the bags are collected before the accumulation, so the threads are balanced by the number of the rows to gather
+    std::vector<Bag> _bags;
+    std::vector<size_t> _bagsRowsBegin;
+
+    std::vector<float> _tableScales;
+    std::shared_ptr<jit_uni_embedding_bag_kernel> _kernel;
 };
 
 }   // namespace node
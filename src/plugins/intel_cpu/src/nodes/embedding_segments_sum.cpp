@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -52,9 +53,9 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
     static const std::set<Precision> supportedPrecisions =
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
+    // the bf16, fp16 and dequantized tables are read as is
+    const auto tablePrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    const auto inDataPrecision = getAccumulationPrecision(tablePrecision);
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -65,7 +66,7 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32}});
@@ -74,7 +75,12 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, getImplType(tablePrecision));
+}
+
+void EmbeddingSegmentsSum::createPrimitive() {
+    createKernel(getSelectedPrimitiveDescriptor()->getConfig().inConfs[EMB_TABLE_IDX].getMemDesc()->getPrecision());
+    Node::createPrimitive();
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
@@ -94,6 +100,18 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
+
+    // the segments are located in one pass instead of the search of the segment ids per bag
+    segmentsBegin_.assign(std::max(numSegments_, 0), -1);
+    segmentsSize_.assign(std::max(numSegments_, 0), 0lu);
+    for (int si = 0; si < indicesSize_; si++) {
+        const int segmentId = segmentIds_[si];
+        if (segmentId < 0 || segmentId >= numSegments_)
+            continue;
+        if (segmentsBegin_[segmentId] < 0)
+            segmentsBegin_[segmentId] = si;
+        segmentsSize_[segmentId]++;
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -101,17 +119,12 @@ void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t&
         IE_THROW() << "Invalid embedding bag index.";
 
     indices = nullptr;
-    size = 0;
+    size = segmentsSize_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    if (size != 0) {
+        indices = indices_ + segmentsBegin_[embIndex];
+        weightsIdx = segmentsBegin_[embIndex];
     }
 
     // Empty bag
@@ -21,6 +21,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
 
@@ -46,6 +47,10 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    // the first index and the number of the indices of each segment
+    std::vector<int> segmentsBegin_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }   // namespace node
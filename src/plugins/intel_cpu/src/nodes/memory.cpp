@@ -78,6 +78,34 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void MemoryOutput::createPrimitive() {
+    auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode);
+    if (!inputMemoryNode)
+        return;
+
+    // the producer writes into the state buffer directly only if the input edge memory isn't shared with the other
+    // edges (in place execution, the other consumers) and has the same layout as the state
+    auto parentEdge = getParentEdgeAt(0);
+    auto& parent = parentEdge->getParent();
+    const auto& stateDesc = inputMemoryNode->getChildEdgeAt(0)->getMemory().getDesc();
+    const void* defaultPtr = parentEdge->getMemory().GetData();
+    canAliasState = parent->getChildEdges().size() == 1 && !parent->isConstant() && !parent->isInPlace() &&
+                    !one_of(parent->getType(), Type::Input, Type::MemoryInput) &&
+                    parentEdge->getMemory().getDesc().isCompatible(stateDesc);
+    for (auto& edge : parent->getParentEdges()) {
+        auto e = edge.lock();
+        if (!e)
+            IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+        if (e->getMemory().GetData() == defaultPtr)
+            canAliasState = false;
+    }
+}
+
+void MemoryOutput::bindState(const MemoryPtr& stateBuffer) {
+    if (canAliasState)
+        getParentEdgeAt(0)->getMemoryPtr()->setDataHandle(stateBuffer->GetData());
+}
+
 void MemoryOutput::execute(dnnl::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
@@ -124,6 +152,47 @@ void MemoryInput::createPrimitive() {
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
+    readStore = dataStore;
+    writeStore = dataStore;
+
+    // the children read the state buffer directly only if they neither modify it nor use its memory in place
+    canAliasState = true;
+    for (auto& childEdge : getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+        if (child->isConstant() || child->isInPlace() ||
+            one_of(child->getType(), Type::Concatenation, Type::Split, Type::Output, Type::MemoryOutput)) {
+            canAliasState = false;
+            break;
+        }
+
+        for (auto& edge : child->getChildEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                canAliasState = false;
+        }
+    }
+}
+
+void MemoryInput::bindState(const MemoryPtr& readBuffer, const MemoryPtr& writeBuffer) {
+    readStore = readBuffer;
+    writeStore = writeBuffer;
+
+    if (canAliasState) {
+        for (auto& childEdge : getChildEdges()) {
+            auto ce = childEdge.lock();
+            if (!ce)
+                IE_THROW() << "Node " << getName() << " contains empty child edge";
+            ce->getMemoryPtr()->setDataHandle(readStore->GetData());
+        }
+    }
+    if (outputNode)
+        outputNode->bindState(writeStore);
 }
 
 /**
@@ -153,17 +222,24 @@ MemoryPtr MemoryInput::getStore() {
 }
 
 void MemoryInput::storeState(const Memory &new_state) {
+    // the producer has already written the new state into the buffer
+    if (new_state.GetData() == writeStore->GetData())
+        return;
     // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
+    //           writeStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*writeStore, new_state);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    // the children read the state buffer directly
+    if (dstMemory.GetData() == readStore->GetData())
+        return;
     // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
+    //           dst_mem.SetData(readStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(dstMemory, *readStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -175,6 +251,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput
         auto outputNode = dynamic_cast<MemoryOutput*>(sibling);
         IE_ASSERT(outputNode != nullptr);
         outputNode->setInputNode(node);
+        node->setOutputNode(outputNode);
     } else {
         holder[node->getId()] = node;
     }
@@ -190,6 +267,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerOutput(MemoryOutpu
         auto inputNode = dynamic_cast<MemoryInput*>(sibling);
         IE_ASSERT(inputNode != nullptr);
         node->setInputNode(inputNode);
+        inputNode->setOutputNode(node);
     } else {
         holder[node->getId()] = node;
     }
@@ -66,7 +66,7 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override {
         return getType() == Type::MemoryOutput;
@@ -76,11 +76,18 @@ public:
         inputNode = node;
     }
 
+    /**
+     * @brief Makes the producer of the new state write it into the state buffer directly, if the memory of the input
+     * edge isn't shared with the other nodes, otherwise the new state is copied into the buffer on execution
+     */
+    void bindState(const MemoryPtr& stateBuffer);
+
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     Node* inputNode = nullptr;
+    bool canAliasState = false;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -101,10 +108,30 @@ public:
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
+    void setOutputNode(MemoryOutput* node) {
+        outputNode = node;
+    }
+    bool hasOutputNode() const {
+        return outputNode != nullptr;
+    }
+
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+
+    /**
+     * @brief Binds the double buffered state of the infer request: the graph reads the state from the first buffer and
+     * the paired MemoryOutput writes the new state into the second one, so the request swaps them after the inference
+     * instead of copying the state. The child edges alias the read buffer if they don't modify or reuse its memory.
+     */
+    void bindState(const MemoryPtr& readBuffer, const MemoryPtr& writeBuffer);
+
  private:
+    // the default state, used until the infer request binds its buffers
     MemoryPtr dataStore;
+    MemoryPtr readStore;
+    MemoryPtr writeStore;
+    MemoryOutput* outputNode = nullptr;
+    bool canAliasState = false;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
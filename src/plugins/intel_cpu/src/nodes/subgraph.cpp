@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <array>
 #include <tuple>
+#include <sstream>
 
 #include <dnnl_debug.h>
 #include <onednn/dnnl.h>
@@ -19,6 +20,8 @@
 #include <ngraph/pass/visualize_tree.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ie_ngraph_utils.hpp>
+#include <openvino/pass/serialize.hpp>
+#include <common/primitive_hashing_utils.hpp>
 
 #include <snippets/op/subgraph.hpp>
 #include "emitters/cpu_generator.hpp"
@@ -33,24 +36,80 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+namespace {
+// Creates a deep local copy of the snippet to perform canonicalization & code generation
+// Todo: Probably better to implement a proper copy constructor
+std::shared_ptr<ngraph::snippets::op::Subgraph> copy_snippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& snippet) {
+    ngraph::OutputVector subgraph_node_inputs;
+    for (const auto &input : snippet->input_values()) {
+        auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+        subgraph_node_inputs.push_back(new_input);
+    }
+    auto new_body = ov::clone_model(*snippet->get_body().get());
+    auto new_snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(snippet, new_snippet);
+    new_snippet->set_friendly_name(snippet->get_friendly_name());
+    return new_snippet;
+}
+
+// The body of the snippet in IR form without the names, so the same bodies of the different nodes are equal
+std::string serialize_body(const std::shared_ptr<ngraph::snippets::op::Subgraph>& snippet) {
+    auto body = ov::clone_model(*snippet->get_body().get());
+    size_t index = 0;
+    for (const auto& op : body->get_ordered_ops()) {
+        op->set_friendly_name(std::to_string(index++));
+        for (auto& output : op->outputs())
+            output.get_tensor().set_names({});
+    }
+    std::stringstream xml, bin;
+    ov::pass::Serialize(xml, bin).run_on_model(body);
+    return xml.str() + bin.str();
+}
+
+struct SnippetKey {
+    std::shared_ptr<const std::string> body;
+    size_t bodyHash;
+    dnnl::impl::cpu::x64::cpu_isa_t isa;
+    // the dims collapsing depends on the number of threads
+    int threadsNum;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputShapes;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        seed = hash_combine(seed, bodyHash);
+        seed = hash_combine(seed, isa);
+        seed = hash_combine(seed, threadsNum);
+        for (const auto& shapes : {&inputShapes, &outputShapes}) {
+            for (const auto& shape : *shapes) {
+                seed = get_vector_hash(seed, std::get<0>(shape));
+                seed = get_vector_hash(seed, std::get<1>(shape));
+                seed = hash_combine(seed, std::get<2>(shape).hash());
+            }
+        }
+        return seed;
+    }
+
+    bool operator==(const SnippetKey& rhs) const {
+        return bodyHash == rhs.bodyHash &&
+               isa == rhs.isa &&
+               threadsNum == rhs.threadsNum &&
+               inputShapes == rhs.inputShapes &&
+               outputShapes == rhs.outputShapes &&
+               (body == rhs.body || *body == *rhs.body);
+    }
+};
+}   // namespace
+
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
         : Node(op, eng, cache) {
     host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_common) ?
         dnnl::impl::cpu::x64::avx512_common : dnnl::impl::cpu::x64::avx2;
 
-    // Create a deep local copy of the input snippet to perform canonicalization & code generation
-    // Todo: Probably better to implement a proper copy constructor
     if (const auto tmp_snippet =  ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op)) {
-        ngraph::OutputVector subgraph_node_inputs;
-        for (const auto &input : tmp_snippet->input_values()) {
-            auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
-            subgraph_node_inputs.push_back(new_input);
-        }
-        auto new_body = ov::clone_model(*tmp_snippet->get_body().get());
-        snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-        ngraph::copy_runtime_info(tmp_snippet, snippet);
-        snippet->set_friendly_name(tmp_snippet->get_friendly_name());
-        snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+        original_snippet = copy_snippet(tmp_snippet);
     } else {
         IE_THROW(NotImplemented) << "Node is not an instance of snippets::op::Subgraph";
     }
@@ -168,21 +227,84 @@ void Snippet::selectOptimalPrimitiveDescriptor() {
     selectPreferPrimitiveDescriptor(getPrimitivesPriority(), true);
 }
 
-void Snippet::createPrimitive() {
+void Snippet::prepareParams() {
+    auto edgeToBlockedShape = [](const EdgePtr& edge) {
+        const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
+        ngraph::Shape shape(blockedDesc->getBlockDims());
+        ngraph::AxisVector blocking(blockedDesc->getOrder());
+        ngraph::element::Type precision = InferenceEngine::details::convertPrecision(blockedDesc->getPrecision());
+        return ngraph::snippets::op::Subgraph::BlockedShape{shape, blocking, precision};
+    };
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputBlockedShapes, outputBlockedShapes;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        inputBlockedShapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        outputBlockedShapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
+
+    if (isDynamicNode()) {
+        // schedule definition and code generation are done once for the body and the shapes,
+        // so the dynamic shapes only pay for them when a new shape is met
+        if (!body_ir) {
+            body_ir = std::make_shared<const std::string>(serialize_body(original_snippet));
+            body_hash = std::hash<std::string>()(*body_ir);
+        }
+        SnippetKey key = {body_ir, body_hash, host_isa, parallel_get_max_threads(),
+                          std::move(inputBlockedShapes), std::move(outputBlockedShapes)};
+        auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetKernel> {
+            return compile(key.inputShapes, key.outputShapes);
+        };
+        auto cache = getRuntimeCache();
+        auto result = cache->getOrCreate(key, builder);
+        snippet_kernel = result.first;
+    } else {
+        // the static node prepares the params once, so the kernel isn't cached and the body isn't serialized
+        snippet_kernel = compile(inputBlockedShapes, outputBlockedShapes);
+    }
+    if (!snippet_kernel) {
+        IE_THROW() << "Snippet node with name '" << getName() << "' couldn't generate the kernel";
+    }
+
+    const auto dataSize = getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].getMemDesc()->getPrecision().size();
+    const size_t inputNum = getParentEdges().size();
+    start_offset_in.resize(inputNum);
+    srcMemPtrs.resize(inputNum);
+    for (size_t i = 0; i < inputNum; i++) {
+        const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
+        srcMemPtrs[i] = memPtr;
+        start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
+    }
+
+    const size_t outputNum = outputShapes.size();
+    start_offset_out.resize(outputNum);
+    dstMemPtrs.resize(outputNum);
+    for (size_t i = 0; i < outputNum; i++) {
+        const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
+        dstMemPtrs[i] = memPtr;
+        start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
+    }
+}
+
+std::shared_ptr<Snippet::SnippetKernel> Snippet::compile(const ngraph::snippets::op::Subgraph::BlockedShapeVector& input_blocked_shapes,
+                                                         const ngraph::snippets::op::Subgraph::BlockedShapeVector& output_blocked_shapes) const {
+    auto k = std::make_shared<SnippetKernel>();
+    k->snippet = copy_snippet(original_snippet);
+    k->snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+
     // schedule definition part
     // it defines offsets, strides and sizes for snippet kernel scheduling
-    define_schedule();
+    define_schedule(*k, input_blocked_shapes, output_blocked_shapes);
 
     // code generation part
     // it might be worth to generate explicitly for scheduler work amount for now,
     // but in future some interface should be defined in order to communicate schedule for a kernel
     // or generate schedule for a kernel.
     // Here kernel is generated for most warying dimension by default.
-    generate();
+    generate(*k);
+    return k;
 }
 
 void Snippet::execute(dnnl::stream strm) {
-    if (schedule.ptr == nullptr || !canUseOptimizedImpl) {
+    if (!snippet_kernel || snippet_kernel->schedule.ptr == nullptr || !snippet_kernel->canUseOptimizedImpl) {
         IE_THROW() << "Snippet can't use Optimized implementation and can't fallback to reference";
     }
     jit_snippets_call_args call_args;
@@ -192,18 +314,27 @@ void Snippet::execute(dnnl::stream strm) {
     for (size_t i = 0; i < dstMemPtrs.size(); i++)
         call_args.dst_ptrs[i] = reinterpret_cast<uint8_t*>(dstMemPtrs[i]->GetData()) + start_offset_out[i];
 
-    if (tensorRank == rank6D) {
+    if (snippet_kernel->tensorRank == rank6D) {
         schedule_6d(call_args);
     } else {
         schedule_nt(call_args);
     }
 }
 
+void Snippet::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
 bool Snippet::created() const {
     return getType() == Type::Subgraph;
 }
 
 bool Snippet::canBeInPlace() const {
+    // the input can be broadcasted to the output shape in runtime
+    if (isDynamicNode()) {
+        return false;
+    }
+
     if (getParentEdgesAtPort(0)[0]->getParent()->getType() == Type::Input) {
         return false;
     }
@@ -249,109 +380,82 @@ static auto collapseLastDims(std::vector<size_t>& dims, size_t dimsToCollapse) -
     }
 }
 
-void Snippet::define_schedule() {
-    auto edgeToBlockedShape = [](const EdgePtr& edge) {
-        const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
-        ngraph::Shape shape(blockedDesc->getBlockDims());
-        ngraph::AxisVector blocking(blockedDesc->getOrder());
-        ngraph::element::Type precision = InferenceEngine::details::convertPrecision(blockedDesc->getPrecision());
-        return ngraph::snippets::op::Subgraph::BlockedShape{shape, blocking, precision};
-    };
-    auto prependWithOnes = [this](const std::vector<size_t>& dims) {
-        if (tensorRank <= dims.size())
+void Snippet::define_schedule(SnippetKernel& k,
+                              const ngraph::snippets::op::Subgraph::BlockedShapeVector& input_blocked_shapes,
+                              const ngraph::snippets::op::Subgraph::BlockedShapeVector& output_blocked_shapes) const {
+    auto prependWithOnes = [&k](const std::vector<size_t>& dims) {
+        if (k.tensorRank <= dims.size())
             return dims;
-        VectorDims result(tensorRank, 1);
-        std::copy(dims.begin(), dims.end(), &result[tensorRank - dims.size()]);
+        VectorDims result(k.tensorRank, 1);
+        std::copy(dims.begin(), dims.end(), &result[k.tensorRank - dims.size()]);
         return result;
     };
-    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes;
-    for (size_t i = 0; i < inputShapes.size(); i++)
-        input_blocked_shapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
-
-    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes;
-    for (size_t i = 0; i < outputShapes.size(); i++)
-        output_blocked_shapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
-    exec_domain = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+    auto& exec_domain = k.exec_domain;
+    exec_domain = k.snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
     // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
-    tensorRank = std::max(static_cast<size_t>(rank6D), exec_domain.size());
+    k.tensorRank = std::max(static_cast<size_t>(rank6D), exec_domain.size());
     // Canonicalization broadcasts inputs and outputs to max input rank, which can be smaller than tensorRank
     // prepend to enable 6D scheduler
     exec_domain = prependWithOnes(exec_domain);
-    const auto &body = snippet->get_body();
+    const auto &body = k.snippet->get_body();
     for (const auto& p : body->get_parameters()) {
-        dims_in.emplace_back(prependWithOnes(p->get_shape()));
+        k.dims_in.emplace_back(prependWithOnes(p->get_shape()));
     }
 
     for (size_t i = 0; i < body->get_output_size(); i++) {
-        dims_out.push_back(prependWithOnes(body->get_output_shape(i)));
+        k.dims_out.push_back(prependWithOnes(body->get_output_shape(i)));
     }
 
-    const auto config = getSelectedPrimitiveDescriptor()->getConfig();
-    const auto dataSize = config.inConfs[0].getMemDesc()->getPrecision().size();
-    auto initOffsets = [this, config, dataSize]() {
+    const auto dataSize = std::get<2>(input_blocked_shapes[0]).size();
+    const auto tensorRank = k.tensorRank;
+    auto initOffsets = [&k, tensorRank, dataSize]() {
         // find max rank input among all outputs
-        const size_t inputNum = getParentEdges().size();
-        offsets_in.resize(inputNum);
+        const size_t inputNum = k.dims_in.size();
+        k.offsets_in.resize(inputNum);
         for (size_t i = 0; i < inputNum; i++) {
-            offsets_in[i].resize(tensorRank, 1);
-            offset_calculation(offsets_in[i], dims_in[i], exec_domain);
+            k.offsets_in[i].resize(tensorRank, 1);
+            offset_calculation(k.offsets_in[i], k.dims_in[i], k.exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_in[i][j] *= dataSize;
+                k.offsets_in[i][j] *= dataSize;
             }
         }
 
-        start_offset_in.resize(inputNum);
-        srcMemPtrs.resize(inputNum);
-        for (size_t i = 0; i < inputNum; i++) {
-            const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
-            srcMemPtrs[i] = memPtr;
-            start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
-        }
-
-        const size_t outputNum = config.outConfs.size();
-        offsets_out.resize(outputNum);
+        const size_t outputNum = k.dims_out.size();
+        k.offsets_out.resize(outputNum);
         for (size_t i = 0; i < outputNum; i++) {
-            offsets_out[i].resize(tensorRank, 1);
-            offset_calculation(offsets_out[i], dims_out[i], exec_domain);
+            k.offsets_out[i].resize(tensorRank, 1);
+            offset_calculation(k.offsets_out[i], k.dims_out[i], k.exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_out[i][j] *= dataSize;
+                k.offsets_out[i][j] *= dataSize;
             }
         }
-
-        start_offset_out.resize(outputNum);
-        dstMemPtrs.resize(outputNum);
-        for (size_t i = 0; i < outputNum; i++) {
-            const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
-            dstMemPtrs[i] = memPtr;
-            start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() * dataSize;
-        }
     };
 
-    auto find_dims_to_collapse = [this, config]() -> int {
+    auto find_dims_to_collapse = [&k, &exec_domain]() -> int {
         int collapsedDims = 0;
         size_t minimalConcurrency = parallel_get_max_threads();
         size_t minimalJitWorkAmount = 256;
         size_t currentJitWorkAmount = exec_domain.back();
-        while (currentJitWorkAmount < minimalJitWorkAmount && currentJitWorkAmount < fullWorkAmount) {
+        while (currentJitWorkAmount < minimalJitWorkAmount && currentJitWorkAmount < k.fullWorkAmount) {
             if (static_cast<int>(exec_domain.size()) - collapsedDims - 2 < 0)
                 break;
 
             bool canCollapse = true;
-            for (size_t i = 0; i < dims_in.size(); i++) {
-                if ((dims_in[i][dims_in[i].size() - 2] != 1 && dims_in[i][dims_in[i].size() - 1] == 1) ||
-                    (dims_in[i][dims_in[i].size() - 2] == 1 && dims_in[i][dims_in[i].size() - 1] != 1)) {
+            for (size_t i = 0; i < k.dims_in.size(); i++) {
+                if ((k.dims_in[i][k.dims_in[i].size() - 2] != 1 && k.dims_in[i][k.dims_in[i].size() - 1] == 1) ||
+                    (k.dims_in[i][k.dims_in[i].size() - 2] == 1 && k.dims_in[i][k.dims_in[i].size() - 1] != 1)) {
                     canCollapse = false;
                     break;
                 }
             }
 
             size_t nextJitWorkAmount = currentJitWorkAmount * exec_domain[exec_domain.size() - 2];
-            if (fullWorkAmount / nextJitWorkAmount >= minimalConcurrency) {
+            if (k.fullWorkAmount / nextJitWorkAmount >= minimalConcurrency) {
                 currentJitWorkAmount = nextJitWorkAmount;
                 // if we cannot use dim collapsing we should use tile2D
                 if (!canCollapse) {
-                    if (tileRank < maxTileRank) {
-                        tileRank++;
+                    if (k.tileRank < maxTileRank) {
+                        k.tileRank++;
                         continue;
                     }
 
@@ -359,10 +463,10 @@ void Snippet::define_schedule() {
                 }
 
                 collapsedDims++;
-                for (auto &d : dims_in)
+                for (auto &d : k.dims_in)
                     collapseLastDims(d, 1);
 
-                for (auto &d : dims_out)
+                for (auto &d : k.dims_out)
                     collapseLastDims(d, 1);
 
                 collapseLastDims(exec_domain, 1);
@@ -373,41 +477,40 @@ void Snippet::define_schedule() {
         return collapsedDims;
     };
 
-    auto initSchedulingInfo = [this, dataSize]() -> void {
+    auto initSchedulingInfo = [&k, &exec_domain, tensorRank, dataSize]() -> void {
         // initialize scheduling information
-        sch_offsets_in.resize(offsets_in.size(), 0);
-        sch_offsets_out.resize(offsets_out.size(), 0);
-        sch_dims.resize(maxTileRank, 1);
-        sch_dims[maxTileRank-1] = exec_domain.back();
-        schedulerWorkAmount = fullWorkAmount / exec_domain.back();
-        if (tileRank > 1) {
-            sch_dims[maxTileRank - tileRank] = exec_domain[tensorRank - 2];
-            schedulerWorkAmount /= exec_domain[tensorRank - 2];
+        k.sch_offsets_in.resize(k.offsets_in.size(), 0);
+        k.sch_offsets_out.resize(k.offsets_out.size(), 0);
+        k.sch_dims.resize(static_cast<size_t>(maxTileRank), 1);
+        k.sch_dims[maxTileRank-1] = exec_domain.back();
+        k.schedulerWorkAmount = k.fullWorkAmount / exec_domain.back();
+        if (k.tileRank > 1) {
+            k.sch_dims[maxTileRank - k.tileRank] = exec_domain[tensorRank - 2];
+            k.schedulerWorkAmount /= exec_domain[tensorRank - 2];
             exec_domain[tensorRank - 2] = 1;
 
             // update offsets for tile 2D because loaders have ptr shifts in some cases and stores have always ptrs shifts
-            for (size_t i = 0; i < offsets_in.size(); i++) {
-                int64_t offset = offsets_in[i][tensorRank - 2];
-                if ((offset > dataSize) || (offset == 0 && dims_in[i].back() != 1)) {
-                    sch_offsets_in[i] = offset - exec_domain.back() * dataSize;
+            for (size_t i = 0; i < k.offsets_in.size(); i++) {
+                int64_t offset = k.offsets_in[i][tensorRank - 2];
+                if ((offset > dataSize) || (offset == 0 && k.dims_in[i].back() != 1)) {
+                    k.sch_offsets_in[i] = offset - exec_domain.back() * dataSize;
                 } else if (offset == dataSize) {
-                    sch_offsets_in[i] = offset;
+                    k.sch_offsets_in[i] = offset;
                 }
             }
 
-            for (size_t i = 0; i < offsets_out.size(); i++) {
-                int64_t offset = offsets_out[i][tensorRank - 2];
-                sch_offsets_out[i] = offset - exec_domain.back() * dataSize;
+            for (size_t i = 0; i < k.offsets_out.size(); i++) {
+                int64_t offset = k.offsets_out[i][tensorRank - 2];
+                k.sch_offsets_out[i] = offset - exec_domain.back() * dataSize;
             }
         }
     };
 
-    fullWorkAmount = 1;
+    k.fullWorkAmount = 1;
     for (const auto &d : exec_domain) {
-        fullWorkAmount *= d;
+        k.fullWorkAmount *= d;
     }
 
-    batchDimIdx = tensorRank - exec_domain.size();
     // Note that exec_domain can be modified inside find_dims_to_collapse() and/or initSchedulingInfo()
     find_dims_to_collapse();
 
@@ -415,30 +518,31 @@ void Snippet::define_schedule() {
     initSchedulingInfo();
 }
 
-void Snippet::generate() {
+void Snippet::generate(SnippetKernel& k) const {
     jit_snippets_compile_args jcp;
-    jcp.output_dims = exec_domain;
-    std::copy(sch_dims.begin(), sch_dims.end(), jcp.scheduler_dims);
-    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), jcp.scheduler_offsets);
-    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &jcp.scheduler_offsets[sch_offsets_in.size()]);
+    jcp.output_dims = k.exec_domain;
+    std::copy(k.sch_dims.begin(), k.sch_dims.end(), jcp.scheduler_dims);
+    std::copy(k.sch_offsets_in.begin(), k.sch_offsets_in.end(), jcp.scheduler_offsets);
+    std::copy(k.sch_offsets_out.begin(), k.sch_offsets_out.end(), &jcp.scheduler_offsets[k.sch_offsets_in.size()]);
     size_t harness_num_dims = jcp.output_dims.size() - 1;
     if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
-        canUseOptimizedImpl = false;
+        k.canUseOptimizedImpl = false;
         harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
     }
-    for (size_t i = 0; i < inputShapes.size(); i++) {
-        auto b = offsets_in[i].begin();
+    for (size_t i = 0; i < k.offsets_in.size(); i++) {
+        auto b = k.offsets_in[i].begin();
         std::copy(b, b + harness_num_dims, &jcp.data_offsets[i * harness_num_dims]);
     }
-    for (size_t i = 0; i < outputShapes.size(); i++) {
-        auto b = offsets_out[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
+    for (size_t i = 0; i < k.offsets_out.size(); i++) {
+        auto b = k.offsets_out[i].begin();
+        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(k.offsets_in.size() + i) * harness_num_dims]);
     }
-    schedule = snippet->generate(reinterpret_cast<void*>(&jcp));
+    k.schedule = k.snippet->generate(reinterpret_cast<void*>(&jcp));
 }
 
 void Snippet::schedule_6d(const jit_snippets_call_args& call_args) const {
-    const auto& dom = exec_domain;
+    const auto& dom = snippet_kernel->exec_domain;
+    const auto& schedule = snippet_kernel->schedule;
     // < N, C, H, W > < 1, 1, N, C*H*W>
     parallel_for5d(dom[0], dom[1], dom[2], dom[3], dom[4],
         [&](int64_t d0, int64_t d1, int64_t d2, int64_t d3, int64_t d4) {
@@ -448,7 +552,9 @@ void Snippet::schedule_6d(const jit_snippets_call_args& call_args) const {
 }
 
 void Snippet::schedule_nt(const jit_snippets_call_args& call_args) const {
-    const auto& work_size = exec_domain;
+    const auto& work_size = snippet_kernel->exec_domain;
+    const auto& schedule = snippet_kernel->schedule;
+    const auto schedulerWorkAmount = snippet_kernel->schedulerWorkAmount;
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
         splitter(schedulerWorkAmount, nthr, ithr, start, end);
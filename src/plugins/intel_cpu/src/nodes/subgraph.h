@@ -31,64 +31,84 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void selectOptimalPrimitiveDescriptor() override;
 
-    // Here we convert to canonical for & jit everything
-    void createPrimitive() override;
+    // Here we convert to canonical for & jit everything, the kernels are taken from the runtime cache if possible
+    void prepareParams() override;
 
     bool canBeInPlace() const override;
     bool created() const override;
 
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+
+    /// The generated kernel with the information about how to schedule it, it's shared via the runtime cache
+    /// between the nodes with the same body and input/output blocked shapes
+    struct SnippetKernel {
+        // Local copy of subgraph node canonicalized for the shapes, owns the generated code
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+
+        // Holds generated snippet with information about how to schedule it
+        ngraph::snippets::Schedule schedule;
+
+        // Holds index of output used as in execution domain
+        // it should be compatible with a schedule's work size
+        std::vector<size_t> exec_domain = {};
+
+        /// scheduling info
+        size_t tensorRank = 0;
+        size_t tileRank = 1;
+        size_t fullWorkAmount = 0;
+        size_t schedulerWorkAmount = 0;
+
+        std::vector<std::vector<size_t>> dims_in = {};
+        std::vector<std::vector<size_t>> offsets_in = {};
+
+        std::vector<std::vector<size_t>> dims_out = {};
+        std::vector<std::vector<size_t>> offsets_out = {};
+
+        std::vector<int64_t> sch_dims = {};
+        std::vector<int64_t> sch_offsets_in = {};
+        std::vector<int64_t> sch_offsets_out = {};
+        bool canUseOptimizedImpl = true;
+    };
 
 private:
     static const size_t rank6D {6};
+    static const size_t maxTileRank {2};
 
     typedef void (*kernel)(const void *, const void *);
 
-    void define_schedule();
+    // Canonicalizes the copy of the original snippet for the shapes and generates the code
+    std::shared_ptr<SnippetKernel> compile(const ngraph::snippets::op::Subgraph::BlockedShapeVector& input_blocked_shapes,
+                                           const ngraph::snippets::op::Subgraph::BlockedShapeVector& output_blocked_shapes) const;
+
+    void define_schedule(SnippetKernel& k,
+                         const ngraph::snippets::op::Subgraph::BlockedShapeVector& input_blocked_shapes,
+                         const ngraph::snippets::op::Subgraph::BlockedShapeVector& output_blocked_shapes) const;
 
-    void generate();
+    void generate(SnippetKernel& k) const;
 
     // Evaluates generated snippet using parallel backend
     void schedule_6d(const jit_snippets_call_args& const_args) const;
     void schedule_nt(const jit_snippets_call_args& const_args) const;
 
-    // Local copy of subgraph node for canonization & code generation
-    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    // Local copy of subgraph node which is never canonicalized, the kernels are generated from its copies
+    std::shared_ptr<ngraph::snippets::op::Subgraph> original_snippet;
+    // The serialized body identifying the snippet in the kernels cache, built for the first shapes of the dynamic node
+    std::shared_ptr<const std::string> body_ir;
+    size_t body_hash = 0;
 
-    // Holds generated snippet with information about how to schedule it
-    ngraph::snippets::Schedule schedule;
+    // The kernel for the current shapes
+    std::shared_ptr<SnippetKernel> snippet_kernel;
 
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
 
-    // Holds index of output used as in execution domain
-    // it should be compatible with a schedule's work size
-    std::vector<size_t> exec_domain = {};
-
-    /// scheduling info
-    size_t batchDimIdx = 0;
-    size_t tensorRank = 0;
-    size_t tileRank = 1;
-    size_t fullWorkAmount = 0;
-    size_t schedulerWorkAmount = 0;
-    const size_t maxTileRank = 2;
-
     std::vector<MemoryPtr> srcMemPtrs = {};
     std::vector<MemoryPtr> dstMemPtrs = {};
 
-    std::vector<std::vector<size_t>> dims_in = {};
-    std::vector<std::vector<size_t>> offsets_in = {};
     std::vector<ptrdiff_t> start_offset_in = {};
     std::vector<ptrdiff_t> start_offset_out = {};
-
-    std::vector<std::vector<size_t>> dims_out = {};
-    std::vector<std::vector<size_t>> offsets_out = {};
-
-    std::vector<int64_t> sch_dims = {};
-    std::vector<int64_t> sch_offsets_in = {};
-    std::vector<int64_t> sch_offsets_out = {};
-    bool canUseOptimizedImpl = true;
 };
 
 }   // namespace node
@@ -234,15 +234,17 @@ void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
         return;
     }
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
+    const auto abs_stride = std::abs(map_rule.stride);
+    if (from->getStaticDims()[map_rule.axis] != abs_stride)
+        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
+        " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
+
+    if (num_chunks == chunk_capacity)
+        grow(eng, 2 * chunk_capacity);
     move_data();
 }
 
 void DynamicBuffer::init(const dnnl::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
-
     const auto axis = map_rule.axis;
     const auto stride = map_rule.stride;
     const auto abs_stride = std::abs(stride);
@@ -257,60 +259,59 @@ void DynamicBuffer::init(const dnnl::engine& eng) {
 
     count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, 1, std::multiplies<size_t>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
-}
-
-std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng) {
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
-
-    const auto old_desc = mem_holder_buffer->get_desc();
-    auto dims = old_desc.dims();
+    chunk_size_in_byte = abs_stride * len;
 
-    if (from->getStaticDims()[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
-
-    dims[axis] += abs_stride;
-    dnnl::memory::desc new_buffer_desc(dims, old_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
+    // the trip count may be just a huge limit of the loop with the condition, so it's not trusted for the large buffers
+    constexpr size_t max_reserved_size_in_byte = size_t{256} << 20;
+    const auto trip_count = static_cast<size_t>(max_iter_count);
+    const auto iter_size_in_byte = std::max<size_t>(count * chunk_size_in_byte, 1);
+    const bool reserve = max_iter_count > 0 && trip_count <= max_reserved_size_in_byte / iter_size_in_byte;
 
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    }
-
-    return std::make_shared<dnnl::memory>(new_buffer_desc, eng);
+    num_chunks = 0;
+    mem_holder_buffer.reset();
+    grow(eng, reserve ? trip_count : 1);
+    move_data();
 }
 
-void DynamicBuffer::move_buffer(std::shared_ptr<dnnl::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
+void DynamicBuffer::grow(const dnnl::engine& eng, const size_t new_capacity) {
+    auto dims = from->GetPrimitive().get_desc().dims();
+    dims[map_rule.axis] = new_capacity * std::abs(map_rule.stride);
+    dnnl::memory::desc new_buffer_desc(dims, from->GetDataType(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
+    auto new_buffer = std::make_shared<dnnl::memory>(new_buffer_desc, eng);
 
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+    if (mem_holder_buffer && num_chunks > 0) {
+        copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()),
+             chunk_capacity * chunk_size_in_byte, new_capacity * chunk_size_in_byte, count, num_chunks * chunk_size_in_byte);
+    }
     mem_holder_buffer = new_buffer;
+    chunk_capacity = new_capacity;
 }
 
 void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+    // the chunks are stored in the order of the iterations, the negative stride is resolved on transfer
+    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + num_chunks * chunk_size_in_byte,
+         chunk_size_in_byte, chunk_capacity * chunk_size_in_byte, count, chunk_size_in_byte);
+    num_chunks++;
 }
 
 void DynamicBuffer::transfer(const Node* node) {
     if (mem_holder_buffer) {
-        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+        auto dims = DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims());
+        dims[map_rule.axis] = num_chunks * std::abs(map_rule.stride);
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(dims);
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        const auto src_stride = chunk_capacity * chunk_size_in_byte;
+        const auto dst_stride = num_chunks * chunk_size_in_byte;
+        auto src = get_ptr(*mem_holder_buffer.get());
+        auto dst = reinterpret_cast<uint8_t*>(to.front()->GetPtr());
+        if (map_rule.stride > 0) {
+            copy(src, dst, src_stride, dst_stride, count, num_chunks * chunk_size_in_byte);
+        } else {
+            for (size_t chunk = 0; chunk < num_chunks; chunk++)
+                copy(src + chunk * chunk_size_in_byte, dst + (num_chunks - 1 - chunk) * chunk_size_in_byte,
+                     src_stride, dst_stride, count, chunk_size_in_byte);
+        }
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -546,6 +547,9 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
 
+    for (auto& buffer : buffers)
+        buffer->setMaxIterCount(max_num_iter);
+
     // use  "i != max_num_iter" only to allow "-1" works like infinite loop
     for (int i = 0; i != max_num_iter && continue_cond; i++) {
         // copy data to subgraph iteration
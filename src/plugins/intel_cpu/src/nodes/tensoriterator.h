@@ -60,7 +60,9 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * The buffer is reserved for the trip count when it's known, otherwise its capacity is doubled on overflow,
+ * so the chunks of the iterations are written in place and the concatenation costs O(N) copying.
  */
 class DynamicBuffer {
 public:
@@ -69,13 +71,14 @@ public:
 
     void execute(const dnnl::engine& eng, const int iter);
     void transfer(const Node* node);
+    // the upper bound of the number of the iterations, -1 if it's unknown
+    void setMaxIterCount(const int max_iter_count_) { max_iter_count = max_iter_count_; }
 
 private:
     void init(const dnnl::engine& eng);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng);
-    void move_buffer(std::shared_ptr<dnnl::memory> new_buffer);
+    void grow(const dnnl::engine& eng, const size_t new_capacity);
     void move_data();
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
@@ -84,8 +87,10 @@ private:
     size_t len = 1lu;
     size_t count = 1lu;
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    size_t chunk_size_in_byte = 0lu;
+    size_t num_chunks = 0lu;
+    size_t chunk_capacity = 0lu;
+    int max_iter_count = -1;
 
     MemoryPtr from;
     std::vector<MemoryPtr> to;
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.h"
+
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+#define CPU_NUMA_SYSCALLS_SUPPORTED
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+size_t getPageSize() {
+#if defined(__linux__)
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+#else
+    return 4096;
+#endif
+}
+
+// the pages lying completely inside the range
+std::pair<uintptr_t, size_t> getInnerPages(const void* data, size_t size) {
+    const auto pageSize = getPageSize();
+    const auto begin = (reinterpret_cast<uintptr_t>(data) + pageSize - 1) / pageSize * pageSize;
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size) / pageSize * pageSize;
+    return {begin, end > begin ? (end - begin) / pageSize : 0};
+}
+
+#if defined(CPU_NUMA_SYSCALLS_SUPPORTED)
+// values from <linux/mempolicy.h>, libnuma is not required
+constexpr int mpolPreferred = 1;
+constexpr unsigned mpolMfMove = 1 << 1;
+#endif
+
+}   // namespace
+
+bool bindToNumaNode(void* data, size_t size, int numaNodeId) {
+#if defined(CPU_NUMA_SYSCALLS_SUPPORTED)
+    constexpr int bitsPerMask = 8 * sizeof(unsigned long);
+    if (numaNodeId < 0 || numaNodeId >= 16 * bitsPerMask)
+        return false;
+
+    const auto pages = getInnerPages(data, size);
+    if (pages.second == 0)
+        return false;
+
+    unsigned long nodeMask[16] = {};
+    nodeMask[numaNodeId / bitsPerMask] = 1ul << (numaNodeId % bitsPerMask);
+    // the kernel ignores the last bit of the mask, so maxnode is one more than the number of the bits used
+    return syscall(SYS_mbind, pages.first, pages.second * getPageSize(), mpolPreferred, nodeMask,
+                   static_cast<unsigned long>(16 * bitsPerMask + 1), mpolMfMove) == 0;
+#else
+    return false;
+#endif
+}
+
+void firstTouch(void* data, size_t size) {
+    const auto pageSize = getPageSize();
+    const auto pagesNumber = (size + pageSize - 1) / pageSize;
+    auto* bytes = static_cast<uint8_t*>(data);
+    InferenceEngine::parallel_for(pagesNumber, [&](size_t i) {
+        const auto offset = i * pageSize;
+        std::memset(bytes + offset, 0, std::min(pageSize, size - offset));
+    });
+}
+
+NumaMemoryStatistics getNumaMemoryStatistics(const void* data, size_t size, int numaNodeId) {
+    NumaMemoryStatistics statistics;
+    const auto pages = getInnerPages(data, size);
+#if defined(CPU_NUMA_SYSCALLS_SUPPORTED)
+    constexpr size_t chunkSize = 1024;
+    std::vector<void*> addresses(chunkSize);
+    std::vector<int> status(chunkSize);
+    for (size_t first = 0; first < pages.second; first += chunkSize) {
+        const auto count = std::min(chunkSize, pages.second - first);
+        for (size_t i = 0; i < count; i++)
+            addresses[i] = reinterpret_cast<void*>(pages.first + (first + i) * getPageSize());
+        // the nodes array is null, so the pages are not moved, only their nodes are reported
+        if (syscall(SYS_move_pages, 0, count, addresses.data(), nullptr, status.data(), 0) != 0) {
+            statistics.unknownPages += count;
+            continue;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (status[i] < 0)
+                statistics.unknownPages++;
+            else if (status[i] == numaNodeId)
+                statistics.localPages++;
+            else
+                statistics.remotePages++;
+        }
+    }
+#else
+    statistics.unknownPages = pages.second;
+#endif
+    return statistics;
+}
+
+void NumaMemoryTracker::track(const MemoryPtr& memory, int numaNodeId) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _memories.emplace_back(memory, numaNodeId);
+}
+
+NumaMemoryStatistics NumaMemoryTracker::getStatistics() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    NumaMemoryStatistics statistics;
+    _memories.erase(std::remove_if(_memories.begin(), _memories.end(), [&](const std::pair<std::weak_ptr<Memory>, int>& item) {
+        const auto memory = item.first.lock();
+        if (!memory)
+            return true;
+        statistics += getNumaMemoryStatistics(memory->GetData(), memory->GetSize(), item.second);
+        return false;
+    }), _memories.end());
+    return statistics;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Placement of the memory pages relative to the NUMA node of the stream owning the memory
+ */
+struct NumaMemoryStatistics {
+    uint64_t localPages = 0;
+    uint64_t remotePages = 0;
+    // the pages which are not touched yet or whose placement can't be queried
+    uint64_t unknownPages = 0;
+
+    NumaMemoryStatistics& operator+=(const NumaMemoryStatistics& other) {
+        localPages += other.localPages;
+        remotePages += other.remotePages;
+        unknownPages += other.unknownPages;
+        return *this;
+    }
+};
+
+/**
+ * @brief Sets the preferred NUMA node of the memory range and migrates the already touched pages there.
+ * Only the pages lying completely inside the range are affected.
+ * @return false if the binding is not supported by the OS or has failed, the memory stays usable in this case
+ */
+bool bindToNumaNode(void* data, size_t size, int numaNodeId);
+
+/**
+ * @brief Touches each page of the memory range from the threads of the current stream,
+ * so the pages are physically allocated before the first inference. The content is zeroed.
+ */
+void firstTouch(void* data, size_t size);
+
+/**
+ * @brief Queries the NUMA nodes of the memory range pages
+ */
+NumaMemoryStatistics getNumaMemoryStatistics(const void* data, size_t size, int numaNodeId);
+
+/**
+ * @brief Collects the NUMA placement of the graphs workspaces for the debug metric.
+ * Keeps weak references only, so the released memory is skipped.
+ */
+class NumaMemoryTracker {
+public:
+    using Ptr = std::shared_ptr<NumaMemoryTracker>;
+
+    void track(const MemoryPtr& memory, int numaNodeId);
+    NumaMemoryStatistics getStatistics() const;
+
+private:
+    mutable std::mutex _mutex;
+    mutable std::vector<std::pair<std::weak_ptr<Memory>, int>> _memories;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
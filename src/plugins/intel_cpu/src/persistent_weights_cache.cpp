@@ -0,0 +1,214 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "persistent_weights_cache.h"
+
+#include "node.h"
+#include "nodes/input.h"
+#include "weights_hash.hpp"
+#include "memory_desc/cpu_memory_desc_utils.h"
+
+#include <openvino/util/file_util.hpp>
+#include <openvino/util/mmap_object.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr char entryMagic[8] = {'O', 'V', 'C', 'P', 'U', 'W', 'E', 'I'};
+constexpr uint32_t entryVersion = 1;
+constexpr size_t dataAlignment = 64;
+
+struct EntryHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t signatureSize;
+    uint64_t dataSize;
+};
+
+size_t getDataOffset(size_t signatureSize) {
+    return (sizeof(EntryHeader) + signatureSize + dataAlignment - 1) / dataAlignment * dataAlignment;
+}
+
+template <typename T>
+void printArray(std::ostream& os, const T* data, int size) {
+    os << "[";
+    for (int i = 0; i < size; i++)
+        os << (i ? "," : "") << data[i];
+    os << "]";
+}
+
+// the full description of the memory layout, the empty string for the formats which can't be cached
+std::string describe(const Memory& memory) {
+    const auto& desc = memory.getDescPtr();
+    if (!desc->isDefined())
+        return {};
+
+    const auto& md = MemoryDescUtils::convertToDnnlMemoryDesc(desc)->getDnnlDesc().data;
+    if (md.format_kind != dnnl_blocked)
+        return {};
+
+    const auto& blk = md.format_desc.blocking;
+    std::stringstream ss;
+    ss << "dt=" << md.data_type << " dims=";
+    printArray(ss, md.dims, md.ndims);
+    ss << " padded_dims=";
+    printArray(ss, md.padded_dims, md.ndims);
+    ss << " padded_offsets=";
+    printArray(ss, md.padded_offsets, md.ndims);
+    ss << " offset0=" << md.offset0 << " strides=";
+    printArray(ss, blk.strides, md.ndims);
+    ss << " inner_blks=";
+    printArray(ss, blk.inner_blks, blk.inner_nblks);
+    ss << " inner_idxs=";
+    printArray(ss, blk.inner_idxs, blk.inner_nblks);
+    ss << " extra=" << md.extra.flags << "," << md.extra.compensation_mask << ","
+       << md.extra.scale_adjust << "," << md.extra.asymm_compensation_mask;
+    return ss.str();
+}
+
+std::string getNodeSignature(const NodePtr& node);
+
+std::string getEdgeSignature(const EdgePtr& edge) {
+    const auto nodeSignature = getNodeSignature(edge->getParent());
+    const auto memorySignature = describe(edge->getMemory());
+    if (nodeSignature.empty() || memorySignature.empty())
+        return {};
+    return nodeSignature + ":" + std::to_string(edge->getInputNum()) + "{" + memorySignature + "}";
+}
+
+// Only the source constants and the reorders are supported for now, since they don't have any other attributes
+// affecting the result except the memory descriptors.
+std::string getNodeSignature(const NodePtr& node) {
+    if (!node->isConstant() || !node->getFusedWith().empty())
+        return {};
+
+    if (node->getType() == Type::Input) {
+        auto input = std::dynamic_pointer_cast<node::Input>(node);
+        auto memory = input ? input->getMemoryPtr() : nullptr;
+        if (!memory)
+            return {};
+        const auto hash = XARCH::weights_hash(static_cast<const unsigned char*>(memory->GetData()), memory->GetSize());
+        std::stringstream ss;
+        ss << "Const(" << memory->GetSize() << "," << std::hex << std::setw(16) << std::setfill('0') << hash << ")";
+        return ss.str();
+    }
+
+    if (node->getType() == Type::Reorder && node->getParentEdges().size() == 1) {
+        const auto parentSignature = getEdgeSignature(node->getParentEdgeAt(0));
+        return parentSignature.empty() ? std::string{} : "Reorder(" + parentSignature + ")";
+    }
+
+    return {};
+}
+
+std::string getVersionSignature() {
+    const auto version = dnnl_version();
+    std::stringstream ss;
+    ss << "v" << entryVersion << " dnnl " << version->major << "." << version->minor << "." << version->patch
+       << " " << version->hash;
+    return ss.str();
+}
+
+}   // namespace
+
+PersistentWeightsCache::PersistentWeightsCache(const std::string& cacheDir)
+    : _cacheDir(ov::util::path_join({cacheDir, "cpu_weights"})) {}
+
+std::string PersistentWeightsCache::getSignature(const EdgePtr& edge) {
+    // the source constants are used as is, there is nothing to store
+    if (edge->getParent()->getType() == Type::Input)
+        return {};
+
+    const auto signature = getEdgeSignature(edge);
+    return signature.empty() ? signature : getVersionSignature() + " " + signature;
+}
+
+std::string PersistentWeightsCache::getEntryPath(const std::string& signature) const {
+    const auto hash = XARCH::weights_hash(reinterpret_cast<const unsigned char*>(signature.data()), signature.size());
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
+    return ov::util::path_join({_cacheDir, ss.str()});
+}
+
+std::shared_ptr<const uint8_t> PersistentWeightsCache::find(const std::string& signature, size_t size) const {
+    const auto path = getEntryPath(signature);
+    if (!ov::util::file_exists(path))
+        return nullptr;
+
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+    try {
+        mapped = ov::util::load_mmap_object(path);
+    } catch (const std::runtime_error&) {
+        return nullptr;
+    }
+
+    const auto dataOffset = getDataOffset(signature.size());
+    if (mapped->size() < dataOffset + size)
+        return nullptr;
+
+    EntryHeader header;
+    std::memcpy(&header, mapped->data(), sizeof(header));
+    if (std::memcmp(header.magic, entryMagic, sizeof(entryMagic)) != 0 || header.version != entryVersion ||
+        header.signatureSize != signature.size() || header.dataSize != size ||
+        signature.compare(0, signature.size(), mapped->data() + sizeof(header), signature.size()) != 0)
+        return nullptr;
+
+    _restored.fetch_add(1, std::memory_order_relaxed);
+    // aliasing constructor, the mapping lives while the data is referenced
+    return std::shared_ptr<const uint8_t>(mapped, reinterpret_cast<const uint8_t*>(mapped->data() + dataOffset));
+}
+
+void PersistentWeightsCache::store(const std::string& signature, const void* data, size_t size) const {
+    static std::atomic<uint64_t> counter{0};
+    static const uint64_t processSalt = std::random_device{}();
+
+    const auto path = getEntryPath(signature);
+    // the entry becomes visible to the other processes only being completely written
+    const auto tmpPath = path + "." + std::to_string(processSalt) + "_" + std::to_string(counter++) + ".tmp";
+    try {
+        ov::util::create_directory_recursive(_cacheDir);
+
+        EntryHeader header;
+        std::memcpy(header.magic, entryMagic, sizeof(entryMagic));
+        header.version = entryVersion;
+        header.signatureSize = static_cast<uint32_t>(signature.size());
+        header.dataSize = size;
+
+        std::ofstream stream(tmpPath, std::ios::binary);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(signature.data(), signature.size());
+        const std::vector<char> padding(getDataOffset(signature.size()) - sizeof(header) - signature.size(), 0);
+        stream.write(padding.data(), padding.size());
+        stream.write(static_cast<const char*>(data), size);
+        stream.close();
+
+        if (!stream || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+            std::remove(tmpPath.c_str());
+        else
+            _stored.fetch_add(1, std::memory_order_relaxed);
+    } catch (const std::exception&) {
+        std::remove(tmpPath.c_str());
+    }
+}
+
+PersistentWeightsCache::Statistics PersistentWeightsCache::getStatistics() const {
+    Statistics statistics;
+    statistics.restored = _restored.load(std::memory_order_relaxed);
+    statistics.stored = _stored.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
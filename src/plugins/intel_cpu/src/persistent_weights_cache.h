@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "edge.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief On-disk storage of the repacked constant weights.
+ *
+ * Complements WeightsSharing, which deduplicates the repacked weights only within the process. Each entry is
+ * a separate file in the cache directory, named by the hash of the entry signature. The signature describes
+ * how the data was produced: the hashes of the source constants, the chain of the constant nodes and the target
+ * memory descriptors. The whole signature is stored in the entry and compared on lookup, so hash collisions
+ * can't lead to a wrong data. The entries are memory mapped on lookup and written via a temporary file, so
+ * several processes may share the same cache directory.
+ */
+class PersistentWeightsCache {
+public:
+    using Ptr = std::shared_ptr<PersistentWeightsCache>;
+
+    explicit PersistentWeightsCache(const std::string& cacheDir);
+
+    /**
+     * @brief Builds the signature of the constant data produced in the edge memory
+     * @param edge - edge connecting the constant subgraph with a non constant node
+     * @return the signature or empty string if the constant subgraph can't be cached
+     */
+    static std::string getSignature(const EdgePtr& edge);
+
+    /**
+     * @brief Searches the entry
+     * @param signature - the entry signature
+     * @param size - expected size of the data in bytes
+     * @return pointer to the mapped data, which keeps the mapping alive, or nullptr if there is no such entry
+     */
+    std::shared_ptr<const uint8_t> find(const std::string& signature, size_t size) const;
+
+    /**
+     * @brief Stores the entry, errors are ignored since the cache is optional
+     * @param signature - the entry signature
+     * @param data - pointer to the data
+     * @param size - size of the data in bytes
+     */
+    void store(const std::string& signature, const void* data, size_t size) const;
+
+    struct Statistics {
+        uint64_t restored = 0;  // the entries found
+        uint64_t stored = 0;    // the entries written
+    };
+
+    Statistics getStatistics() const;
+
+private:
+    std::string getEntryPath(const std::string& signature) const;
+
+    std::string _cacheDir;
+    mutable std::atomic<uint64_t> _restored{0};
+    mutable std::atomic<uint64_t> _stored{0};
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -90,6 +90,7 @@
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/op/util/op_types.hpp>
+#include <openvino/op/util/multi_subgraph_base.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/graph_util.hpp>
 
@@ -118,6 +119,8 @@
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
+#include "ngraph_transformations/mark_embedding_table_dequantization.hpp"
+#include "ngraph_transformations/compress_embedding_table.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 #ifndef __GNUC_PREREQ
@@ -176,7 +179,8 @@ Engine::~Engine() {
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT,
-                                               const bool _enableSnippets, const bool isLegacyApi) {
+                                               const bool _enableSnippets, const bool _enableDynamicSnippets,
+                                               const bool isLegacyApi) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -219,6 +223,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
 
     static const auto precisions = get_convert_precisions();
 
+    manager.register_pass<MarkEmbeddingTableDequantization>();
     manager.register_pass<ngraph::pass::CommonOptimizations>();
     manager.register_pass<ngraph::pass::WrapInterpolateIntoTransposes>();
     manager.register_pass<ngraph::pass::TransposeSinking>();
@@ -246,6 +251,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     manager.register_pass<ngraph::pass::ConvertPrecision>(precisions);
     manager.register_pass<ngraph::pass::EliminateConvert>();
     manager.register_pass<SwapConvertTranspose>();
+    // the fp16 table is converted by the embedding kernel only
+    if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2) &&
+        dnnl::impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C))
+        manager.register_pass<CompressEmbeddingTable>();
 
     auto pass_config = manager.get_pass_config();
 
@@ -529,8 +538,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         tokenization_manager.register_pass<ngraph::snippets::pass::EnumerateNodes>();
         tokenization_manager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
         tokenization_manager.get_pass_config()->set_callback<ngraph::snippets::pass::TokenizeSnippets>(
-                [](const std::shared_ptr<const ov::Node>& n) -> bool {
+                [_enableDynamicSnippets](const std::shared_ptr<const ov::Node>& n) -> bool {
                     const auto& inputs = n->inputs();
+                    // the kernels of the dynamic snippets are generated at runtime for each new shape
+                    if (!_enableDynamicSnippets && n->is_dynamic())
+                        return true;
                     // todo: clarify whether we can evaluate snippets on const paths
                     const bool has_only_const_inputs = std::all_of(inputs.begin(), inputs.end(),
                                 [](const ov::Input<const ov::Node> &in) {
@@ -538,7 +550,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                                       });
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t ) {
-                        // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                        // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                         return t.get_partial_shape().rank().get_length() > 6;
                     };
                     const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -552,12 +564,28 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     }
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const bool isLegacyApi) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets,
+                           const bool _enableDynamicSnippets, const bool isLegacyApi) {
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, isLegacyApi);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, _enableDynamicSnippets, isLegacyApi);
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
+// the shape subgraphs are constant folded by the transformations, so the transformed model can't be reshaped
+static bool hasShapeSubgraphs(const std::shared_ptr<const ov::Model>& model) {
+    for (const auto& op : model->get_ops()) {
+        if (ov::is_type<ngraph::opset1::ShapeOf>(op) || ov::is_type<ngraph::opset3::ShapeOf>(op))
+            return true;
+        if (const auto subgraphOp = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < subgraphOp->get_internal_subgraphs_size(); i++) {
+                if (hasShapeSubgraphs(subgraphOp->get_function(static_cast<int>(i))))
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
 static bool streamsSet(const std::map<std::string, std::string>& config) {
     return config.count(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) ||
            config.count(ov::num_streams.name());
@@ -686,8 +714,12 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& dynamicSnippetsProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_CPU_DYNAMIC_SNIPPETS);
+    const bool enableDynamicSnippets = dynamicSnippetsProp != config.end()
+            ? dynamicSnippetsProp->second == PluginConfigParams::YES
+            : engConfig.dynamicSnippets;
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, isLegacyAPI());
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, enableDynamicSnippets, isLegacyAPI());
 
     // need to check that all outputs have static shapes
     // checking that all inputs have static shapes is performed in the common part
@@ -711,6 +743,11 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
+    // the graphs for the other input shapes are created from the transformed model, which must not depend on the
+    // model input shapes
+    if (conf.shapeVariants && hasShapeSubgraphs(network.getFunction())) {
+        conf.shapeVariants = 0;
+    }
 
     return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
 }
@@ -927,7 +964,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
         const bool enableSnippets = !(conf.cache_dir.empty() || conf.enableDynamicBatch || (conf.enforceBF16
                 && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)));
-        Transformation(clonedNetwork, enableLPT, enableSnippets, isLegacyAPI());
+        Transformation(clonedNetwork, enableLPT, enableSnippets, conf.dynamicSnippets, isLegacyAPI());
         auto ops = clonnedFunction->get_ordered_ops();
 
         //Mark removed nodes as supported
@@ -1029,8 +1066,26 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
-
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    // the model is stored transformed, so it's unknown whether the shape subgraphs were folded
+    conf.shapeVariants = 0;
+
+    // the graph is created with the implementations and the memory formats selected when it was exported,
+    // so the layouts selection is not repeated
+    const auto& nodesSelection = deserializer.getNodesSelection();
+    Graph::ReplacedSelection replacedSelection;
+    if (!nodesSelection.empty())
+        replacedSelection = Graph::setNodesSelection(cnnnetwork.getFunction(), nodesSelection);
+
+    std::shared_ptr<ExecNetwork> execNetwork;
+    try {
+        execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    } catch (const SelectionMismatch&) {
+        // the stored selection doesn't fit the nodes created by this build of the plugin, so it's repeated
+        if (nodesSelection.empty())
+            throw;
+        Graph::resetNodesSelection(replacedSelection);
+        execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    }
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -4,8 +4,12 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <openvino/util/mmap_object.hpp>
+
+#include <cstring>
 
 #include <pugixml.hpp>
+#include <dnnl.hpp>
 
 using namespace InferenceEngine;
 
@@ -65,11 +69,40 @@ namespace {
             it->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    /*
+     * @brief The allocator of the blob over the part of the mapped file, keeps the mapping alive
+     */
+    class MappedMemoryAllocator final : public InferenceEngine::IAllocator {
+    public:
+        MappedMemoryAllocator(std::shared_ptr<ov::util::MappedMemory> memory, size_t offset, size_t size)
+            : _memory(std::move(memory))
+            , _data(_memory->data() + offset)
+            , _size(size) {}
+
+        void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+            return handle == _data ? handle : nullptr;
+        }
+        void unlock(void*) noexcept override {}
+        void* alloc(size_t size) noexcept override {
+            return size <= _size ? _data : nullptr;
+        }
+        bool free(void*) noexcept override {
+            return false;
+        }
+
+    private:
+        std::shared_ptr<ov::util::MappedMemory> _memory;
+        char* _data;
+        size_t _size;
+    };
 };  // namespace
 
-CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager,
+                                           std::map<std::string, Graph::NodeSelection> nodesSelection)
     : _ostream(ostream)
-    , _extensionManager(extensionManager) {
+    , _extensionManager(extensionManager)
+    , _nodesSelection(std::move(nodesSelection)) {
 }
 
 void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
@@ -115,6 +148,19 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(to_string(out.second->getLayout()).c_str());
         }
 
+        if (!_nodesSelection.empty()) {
+            // the selection is valid only for the same instruction set
+            pugi::xml_node graph = root.append_child("compiled_graph");
+            graph.append_attribute("isa").set_value(static_cast<int>(dnnl::get_effective_cpu_isa()));
+            for (const auto & selection : _nodesSelection) {
+                auto node = graph.append_child("node");
+                node.append_attribute("name").set_value(selection.first.c_str());
+                node.append_attribute("priority").set_value(selection.second.primitivesPriority.c_str());
+                node.append_attribute("inputs").set_value(selection.second.inputMemoryFormats.c_str());
+                node.append_attribute("outputs").set_value(selection.second.outputMemoryFormats.c_str());
+            }
+        }
+
         xml_doc.save(stream);
     };
 
@@ -136,13 +182,33 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     std::string xmlString, xmlInOutString;
     InferenceEngine::Blob::Ptr dataBlob;
 
+    // The stream positions are the offsets in the mapped file
+    auto mmapStream = dynamic_cast<ov::util::MmapStream*>(&_istream);
+    std::shared_ptr<ov::util::MappedMemory> mapped = mmapStream ? mmapStream->get_memory() : nullptr;
+    auto checkMappedRange = [&](size_t offset, size_t size) {
+        if (offset > mapped->size() || size > mapped->size() - offset) {
+            IE_THROW(NetworkNotRead) << "The cached network is truncated.";
+        }
+    };
+
     StreamSerialize::DataHeader hdr = {};
-    _istream.read(reinterpret_cast<char*>(&hdr), sizeof hdr);
+    if (mapped) {
+        const size_t hdrOffset = static_cast<size_t>(_istream.tellg());
+        checkMappedRange(hdrOffset, sizeof hdr);
+        std::memcpy(&hdr, mapped->data() + hdrOffset, sizeof hdr);
+    } else {
+        _istream.read(reinterpret_cast<char*>(&hdr), sizeof hdr);
+    }
 
     // read CNNNetwork input/output precisions
-    _istream.seekg(hdr.custom_data_offset);
-    xmlInOutString.resize(hdr.custom_data_size);
-    _istream.read(const_cast<char*>(xmlInOutString.c_str()), hdr.custom_data_size);
+    if (mapped) {
+        checkMappedRange(hdr.custom_data_offset, hdr.custom_data_size);
+        xmlInOutString.assign(mapped->data() + hdr.custom_data_offset, hdr.custom_data_size);
+    } else {
+        _istream.seekg(hdr.custom_data_offset);
+        xmlInOutString.resize(hdr.custom_data_size);
+        _istream.read(const_cast<char*>(xmlInOutString.c_str()), hdr.custom_data_size);
+    }
     pugi::xml_document xmlInOutDoc;
     auto res = xmlInOutDoc.load_string(xmlInOutString.c_str());
     if (res.status != pugi::status_ok) {
@@ -150,18 +216,35 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     }
 
     // read blob content
-    _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        const InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U8,
+                                               {hdr.consts_size},
+                                               InferenceEngine::Layout::C);
+        if (mapped) {
+            // the constants alias the mapped file, so only the used pages are read
+            checkMappedRange(hdr.consts_offset, hdr.consts_size);
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                desc, std::make_shared<MappedMemoryAllocator>(mapped, hdr.consts_offset, hdr.consts_size));
+            dataBlob->allocate();
+        } else {
+            _istream.seekg(hdr.consts_offset);
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(desc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
-    _istream.seekg(hdr.model_offset);
-    xmlString.resize(hdr.model_size);
-    _istream.read(const_cast<char*>(xmlString.c_str()), hdr.model_size);
+    if (mapped) {
+        checkMappedRange(hdr.model_offset, hdr.model_size);
+        xmlString.assign(mapped->data() + hdr.model_offset, hdr.model_size);
+        // leave the stream where the reading would do
+        _istream.seekg(hdr.model_offset + hdr.model_size);
+    } else {
+        _istream.seekg(hdr.model_offset);
+        xmlString.resize(hdr.model_size);
+        _istream.read(const_cast<char*>(xmlString.c_str()), hdr.model_size);
+    }
 
     network = _cnn_network_builder(xmlString, std::move(dataBlob));
 
@@ -172,6 +255,17 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setPrecisionsAndLayouts(inputs.children("in"), network.getInputsInfo());
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
+
+    _nodesSelection.clear();
+    pugi::xml_node graph = root.child("compiled_graph");
+    if (graph && graph.attribute("isa").as_int(-1) == static_cast<int>(dnnl::get_effective_cpu_isa())) {
+        for (auto node : graph.children("node")) {
+            auto& selection = _nodesSelection[node.attribute("name").value()];
+            selection.primitivesPriority = node.attribute("priority").value();
+            selection.inputMemoryFormats = node.attribute("inputs").value();
+            selection.outputMemoryFormats = node.attribute("outputs").value();
+        }
+    }
 }
 
 }   // namespace intel_cpu
@@ -3,6 +3,7 @@
 //
 #pragma once
 #include "extension_mngr.h"
+#include "graph.h"
 
 #include <iostream>
 #include <functional>
@@ -13,12 +14,17 @@ namespace intel_cpu {
 
 class CNNNetworkSerializer {
 public:
-    CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager);
+    /**
+     * @param nodesSelection The selection of the compiled graph stored along with the network, optional
+     */
+    CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager,
+                         std::map<std::string, Graph::NodeSelection> nodesSelection = {});
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     ExtensionManager::Ptr _extensionManager;
+    std::map<std::string, Graph::NodeSelection> _nodesSelection;
 };
 
 class CNNNetworkDeserializer {
@@ -30,9 +36,18 @@ public:
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
 
+    /**
+     * @brief The selection of the compiled graph read along with the network. Empty if it wasn't exported
+     * or was exported on the CPU with the other ISA.
+     */
+    const std::map<std::string, Graph::NodeSelection>& getNodesSelection() const {
+        return _nodesSelection;
+    }
+
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::map<std::string, Graph::NodeSelection> _nodesSelection;
 };
 
 // const std::string& model, const Blob::CPtr& weights
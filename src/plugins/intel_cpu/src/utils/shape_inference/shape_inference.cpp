@@ -15,6 +15,7 @@
 
 #include "assign_shape_inference.hpp"
 #include "bucketize_shape_inference.hpp"
+#include "concat_shape_inference.hpp"
 #include "convolution_shape_inference.hpp"
 #include "ctc_greedy_decoder_seq_len_shape_inference.hpp"
 #include "ctc_greedy_decoder_shape_inference.hpp"
@@ -23,6 +24,7 @@
 #include "einsum_shape_inference.hpp"
 #include "embedding_segments_sum_shape_inference.hpp"
 #include "embeddingbag_offsets_shape_inference.hpp"
+#include "embeddingbag_packed_shape_inference.hpp"
 #include "experimental_detectron_detection_output_shape_inference.hpp"
 #include "experimental_detectron_generate_proposals_shape_inference.hpp"
 #include "experimental_detectron_prior_grid_generator_shape_inference.hpp"
@@ -32,11 +34,13 @@
 #include "fake_quantize.hpp"
 #include "fft_base_shape_inference.hpp"
 #include "gather_elements_shape_inference.hpp"
+#include "gather_nd_shape_inference.hpp"
 #include "gather_shape_inference.hpp"
 #include "gather_tree_shape_inference.hpp"
 #include "interpolate_shape_inference.hpp"
 #include "lstm_cell_shape_inference.hpp"
 #include "one_hot_shape_inference.hpp"
+#include "pooling_shape_inference.hpp"
 #include "read_value_shape_inference.hpp"
 #include "reduce_shape_inference.hpp"
 #include "reverse_sequence_shape_inference.hpp"
@@ -64,6 +68,8 @@
 #include "reorg_yolo_shape_inference.hpp"
 #include "reverse_sequence_shape_inference.hpp"
 #include "roi_align_shape_inference.hpp"
+#include "roi_pooling_shape_inference.hpp"
+#include "rnn_shape_inference.hpp"
 #include "roll_shape_inference.hpp"
 #include "scatter_elements_update_shape_inference.hpp"
 #include "scatter_nd_base_shape_inference.hpp"
@@ -71,24 +77,34 @@
 #include "shape_inference.hpp"
 #include "shape_nodes.hpp"
 #include "shuffle_channels_shape_inference.hpp"
+#include "slice_shape_inference.hpp"
 #include "split_shape_inference.hpp"
 #include "broadcast_shape_inference.hpp"
 #include "static_shape.hpp"
 #include "strided_slice_shape_inference.hpp"
 #include "tile_shape_inference.hpp"
 #include "topk_shape_inference.hpp"
+#include "transpose_shape_inference.hpp"
 #include "utils.hpp"
 #include "variadic_split_shape_inference.hpp"
 #include "matmul_shape_inference.hpp"
 
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <common/primitive_hashing_utils.hpp>
+
 namespace ov {
 namespace intel_cpu {
 
+static std::shared_ptr<IShapeInfer> make_native_shape_inference(const std::shared_ptr<ngraph::Node>& op);
+static std::shared_ptr<IShapeInfer> make_shape_inference_entry(const std::shared_ptr<ngraph::Node>& op);
+
 void shape_inference(ov::Node* op,
                      const std::vector<StaticShape>& input_shapes,
                      std::vector<StaticShape>& output_shapes,
                      const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) {
-    auto shapeInfer = make_shape_inference(op->shared_from_this());
+    auto shapeInfer = make_shape_inference_entry(op->shared_from_this());
     output_shapes = shapeInfer->infer(input_shapes, constant_data);
 }
 
@@ -117,6 +133,10 @@ public:
         return input_ranks;
     }
 
+    bool has_pads() const override {
+        return false;
+    }
+
 protected:
     std::vector<int64_t> input_ranks;
     std::shared_ptr<ov::Node> node;
@@ -302,6 +322,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
+    bool has_pads() const override {
+        return true;
+    }
 
     void post_validate_and_infer_types(const std::shared_ptr<ov::Node>& local_op) override {
         auto node = dynamic_cast<OP*>(local_op.get());
@@ -338,6 +361,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
+    bool has_pads() const override {
+        return true;
+    }
     std::vector<StaticShape> infer(
         const std::vector<StaticShape>& input_shapes,
         const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
@@ -365,6 +391,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
+    bool has_pads() const override {
+        return true;
+    }
     std::vector<StaticShape> infer(
         const std::vector<StaticShape>& input_shapes,
         const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
@@ -392,6 +421,254 @@ protected:
     bool is_grouped;
 };
 
+template <typename OP>
+class entryPooling : public entryBase {
+public:
+    using entryBase::entryBase;
+
+    const ov::CoordinateDiff& get_pads_begin() override {
+        return pads_begin;
+    }
+    const ov::CoordinateDiff& get_pads_end() override {
+        return pads_end;
+    }
+    bool has_pads() const override {
+        return true;
+    }
+    std::vector<StaticShape> infer(
+        const std::vector<StaticShape>& input_shapes,
+        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+        auto op = static_cast<OP*>(node.get());
+        std::vector<StaticShape> output_shapes(op->get_output_size());
+        shape_infer(op, pads_begin, pads_end, input_shapes, output_shapes);
+        return output_shapes;
+    }
+
+protected:
+    ov::CoordinateDiff pads_begin, pads_end;
+};
+
+/**
+ * @brief Memoizes the results of the wrapped shape inference, together with the pads produced as by-product, by the
+ * input shapes and the values of the inputs the output shapes depend on. So the repeated input shapes are inferred at
+ * the cost of the lookup. The inputs are compared with the most recent result first, then with the results of the
+ * same hash, both in place, so nothing is allocated until the shape inference misses.
+ */
+class entryMemoized : public IMemoizedShapeInfer {
+public:
+    explicit entryMemoized(std::shared_ptr<IShapeInfer> shape_infer) : shape_infer(std::move(shape_infer)) {}
+
+    std::vector<StaticShape> infer(
+        const std::vector<StaticShape>& input_shapes,
+        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+        const ShapesInputs inputs(input_shapes, constant_data);
+        const auto& result = lookup(inputs, input_shapes.size(), inputs.value_port_mask(), [&]() {
+            return shape_infer->infer(input_shapes, constant_data);
+        });
+        return std::vector<StaticShape>(result.output_dims.begin(), result.output_dims.end());
+    }
+
+    const std::vector<VectorDims>& infer(const IShapeInferInputs& inputs, uint32_t value_port_mask) override {
+        const auto inputs_num = shape_infer->get_input_ranks().size();
+        const auto& result = lookup(inputs, inputs_num, value_port_mask, [&]() {
+            std::vector<StaticShape> input_shapes;
+            std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> input_values;
+            input_shapes.reserve(inputs_num);
+            for (size_t port = 0; port < inputs_num; port++) {
+                const auto& dims = get_dims(inputs, port);
+                input_shapes.emplace_back(dims);
+                if (value_port_mask & (1u << port)) {
+                    input_values[port] = std::make_shared<ngraph::runtime::HostTensor>(
+                        inputs.get_element_type(port),
+                        ov::Shape(dims),
+                        const_cast<void*>(inputs.get_data(port)));
+                }
+            }
+            return shape_infer->infer(input_shapes, input_values);
+        });
+        return result.output_dims;
+    }
+
+    const ov::CoordinateDiff& get_pads_begin() override {
+        return shape_infer->has_pads() && last ? last->pads_begin : shape_infer->get_pads_begin();
+    }
+
+    const ov::CoordinateDiff& get_pads_end() override {
+        return shape_infer->has_pads() && last ? last->pads_end : shape_infer->get_pads_end();
+    }
+
+    const std::vector<int64_t>& get_input_ranks() override {
+        return shape_infer->get_input_ranks();
+    }
+
+    bool has_pads() const override {
+        return shape_infer->has_pads();
+    }
+
+private:
+    // the number of the different input shapes kept, e.g. the sequence lengths of a dynamic model
+    static constexpr size_t cache_capacity = 64;
+
+    // the static shapes and the tensors of the values seen as the inputs read in place
+    class ShapesInputs : public IShapeInferInputs {
+    public:
+        ShapesInputs(const std::vector<StaticShape>& input_shapes,
+                     const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data)
+            : input_dims(input_shapes.size()), constant_data(constant_data) {
+            std::transform(input_shapes.begin(), input_shapes.end(), input_dims.begin(), [](const StaticShape& s) {
+                return s.to_shape();
+            });
+        }
+
+        const VectorDims& get_dims(size_t port) const override {
+            return input_dims[port];
+        }
+
+        ov::element::Type get_element_type(size_t port) const override {
+            return constant_data.at(port)->get_element_type();
+        }
+
+        const void* get_data(size_t port) const override {
+            return constant_data.at(port)->get_data_ptr();
+        }
+
+        uint32_t value_port_mask() const {
+            uint32_t mask = 0;
+            for (const auto& item : constant_data)
+                mask |= 1u << item.first;
+            return mask;
+        }
+
+    private:
+        std::vector<VectorDims> input_dims;
+        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data;
+    };
+
+    struct Result {
+        size_t hash;
+        std::vector<VectorDims> input_dims;
+        // the port and the data of the inputs the output shapes depend on
+        std::vector<std::pair<size_t, std::vector<uint8_t>>> values;
+        std::vector<VectorDims> output_dims;
+        ov::CoordinateDiff pads_begin, pads_end;
+    };
+
+    // the scalar inputs are inferred with the shape {} whatever the dims of their memory are
+    const VectorDims& get_dims(const IShapeInferInputs& inputs, size_t port) const {
+        static const VectorDims scalar_dims;
+        const auto& ranks = shape_infer->get_input_ranks();
+        return port < ranks.size() && ranks[port] == 0 ? scalar_dims : inputs.get_dims(port);
+    }
+
+    size_t get_data_size(const IShapeInferInputs& inputs, size_t port) const {
+        return inputs.get_element_type(port).size() * ov::shape_size(get_dims(inputs, port));
+    }
+
+    size_t hash(const IShapeInferInputs& inputs, size_t inputs_num, uint32_t value_port_mask) const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        for (size_t port = 0; port < inputs_num; port++) {
+            const auto& dims = get_dims(inputs, port);
+            seed = hash_combine(seed, dims.size());
+            for (const auto dim : dims)
+                seed = hash_combine(seed, dim);
+        }
+        for (size_t port = 0; port < inputs_num; port++) {
+            if (!(value_port_mask & (1u << port)))
+                continue;
+            const auto data = static_cast<const uint8_t*>(inputs.get_data(port));
+            const auto size = get_data_size(inputs, port);
+            seed = hash_combine(seed, port);
+            for (size_t i = 0; i < size; i++)
+                seed = hash_combine(seed, data[i]);
+        }
+        return seed;
+    }
+
+    bool matches(const Result& result,
+                 const IShapeInferInputs& inputs,
+                 size_t inputs_num,
+                 uint32_t value_port_mask) const {
+        if (result.input_dims.size() != inputs_num)
+            return false;
+        for (size_t port = 0; port < inputs_num; port++) {
+            if (result.input_dims[port] != get_dims(inputs, port))
+                return false;
+        }
+        auto value = result.values.begin();
+        for (size_t port = 0; port < inputs_num; port++) {
+            if (!(value_port_mask & (1u << port)))
+                continue;
+            if (value == result.values.end() || value->first != port ||
+                value->second.size() != get_data_size(inputs, port) ||
+                !std::equal(value->second.begin(), value->second.end(),
+                            static_cast<const uint8_t*>(inputs.get_data(port))))
+                return false;
+            ++value;
+        }
+        return value == result.values.end();
+    }
+
+    template <typename InferFunc>
+    const Result& lookup(const IShapeInferInputs& inputs,
+                         size_t inputs_num,
+                         uint32_t value_port_mask,
+                         InferFunc infer_func) {
+        if (last && matches(*last, inputs, inputs_num, value_port_mask))
+            return *last;
+
+        const auto seed = hash(inputs, inputs_num, value_port_mask);
+        const auto candidates = index.equal_range(seed);
+        for (auto candidate = candidates.first; candidate != candidates.second; ++candidate) {
+            if (matches(*candidate->second, inputs, inputs_num, value_port_mask)) {
+                results.splice(results.begin(), results, candidate->second);
+                last = &*candidate->second;
+                return *last;
+            }
+        }
+
+        const auto output_shapes = infer_func();
+        if (results.size() == cache_capacity) {
+            const auto evicted = std::prev(results.end());
+            const auto evicted_candidates = index.equal_range(evicted->hash);
+            for (auto candidate = evicted_candidates.first; candidate != evicted_candidates.second; ++candidate) {
+                if (candidate->second == evicted) {
+                    index.erase(candidate);
+                    break;
+                }
+            }
+            results.pop_back();
+        }
+
+        Result result;
+        result.hash = seed;
+        for (size_t port = 0; port < inputs_num; port++) {
+            result.input_dims.push_back(get_dims(inputs, port));
+            if (value_port_mask & (1u << port)) {
+                const auto data = static_cast<const uint8_t*>(inputs.get_data(port));
+                result.values.emplace_back(port, std::vector<uint8_t>(data, data + get_data_size(inputs, port)));
+            }
+        }
+        for (const auto& shape : output_shapes)
+            result.output_dims.push_back(shape.to_shape());
+        if (shape_infer->has_pads()) {
+            result.pads_begin = shape_infer->get_pads_begin();
+            result.pads_end = shape_infer->get_pads_end();
+        }
+        results.push_front(std::move(result));
+        index.emplace(seed, results.begin());
+        last = &results.front();
+        return *last;
+    }
+
+    std::shared_ptr<IShapeInfer> shape_infer;
+    // the most recently used first
+    std::list<Result> results;
+    std::unordered_multimap<size_t, std::list<Result>::iterator> index;
+    const Result* last = nullptr;
+};
+
 template <typename OP>
 std::shared_ptr<entryIOC<OP>> make_shared_entryIOC(std::shared_ptr<OP> node) {
     return std::make_shared<entryIOC<OP>>(node);
@@ -402,7 +679,11 @@ std::shared_ptr<entryIO<OP>> make_shared_entryIO(std::shared_ptr<OP> node) {
     return std::make_shared<entryIO<OP>>(node);
 }
 
-std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::Node>& op) {
+std::shared_ptr<IMemoizedShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::Node>& op) {
+    return std::make_shared<entryMemoized>(make_shape_inference_entry(op));
+}
+
+static std::shared_ptr<IShapeInfer> make_native_shape_inference(const std::shared_ptr<ngraph::Node>& op) {
     if (auto node = ov::as_type_ptr<ov::opset8::Convolution>(op)) {
         return std::make_shared<entryConv<ov::opset8::Convolution>>(node, false);
     } else if (auto node = ov::as_type_ptr<ov::opset8::GroupConvolution>(op)) {
@@ -419,10 +700,16 @@ std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::
                ov::is_type<ov::opset1::Clamp>(op) || ov::is_type<ov::opset1::GRN>(op) || ov::is_type<ov::opset1::NormalizeL2>(op) ||
                ov::is_type<ov::opset1::LogicalNot>(op) || ov::is_type<ov::opset4::Mish>(op) || ov::is_type<ov::opset2::MVN>(op) ||
                ov::is_type<ov::opset1::Relu>(op) || ov::is_type<ov::opset1::Elu>(op) || ov::is_type<ov::opset1::Softmax>(op) ||
-               ov::is_type<ov::opset8::Softmax>(op) || ov::is_type<ov::opset5::Round>(op)) {
+               ov::is_type<ov::opset8::Softmax>(op) || ov::is_type<ov::opset5::Round>(op) ||
+               ov::is_type<ov::op::v0::Gelu>(op) || ov::is_type<ov::opset4::SoftPlus>(op) ||
+               ov::is_type<ov::opset5::LogSoftmax>(op)) {
         return std::make_shared<entryCopy>(op);
     } else if (ov::is_type<ov::opset6::MVN>(op) || ov::is_type<ov::opset1::LRN>(op) ||
-               ov::is_type<ov::opset1::PRelu>(op) || ov::is_type<ov::opset4::Swish>(op)) {
+               ov::is_type<ov::opset1::PRelu>(op) || ov::is_type<ov::opset4::Swish>(op) ||
+               ov::is_type<ov::opset3::CumSum>(op) || ov::is_type<ov::opset3::ScatterUpdate>(op) ||
+               ov::is_type<ov::opset1::HardSigmoid>(op) || ov::is_type<ov::opset1::Selu>(op) ||
+               ov::is_type<ov::opset1::ConvertLike>(op) || ov::is_type<ov::op::v1::Reverse>(op) ||
+               ov::is_type<ov::opset5::BatchNormInference>(op)) {
         return std::make_shared<entryFirstPassthrough>(op);
     } else if (ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(op) ||
                ov::is_type<ov::op::util::BinaryElementwiseComparison>(op) ||
@@ -444,12 +731,16 @@ std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::
         return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::opset3::TopK>(op)) {
         return make_shared_entryIOC(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset1::TopK>(op)) {
+        return make_shared_entryIOC(node);
     } else if (auto node = ov::as_type_ptr<ov::opset3::Bucketize>(op)) {
         return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::opset3::EmbeddingSegmentsSum>(op)) {
         return make_shared_entryIOC(node);
     } else if (auto node = ov::as_type_ptr<ov::opset3::EmbeddingBagOffsetsSum>(op)) {
         return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset3::EmbeddingBagPackedSum>(op)) {
+        return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::opset6::ExperimentalDetectronROIFeatureExtractor>(op)) {
         return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::opset1::Pad>(op)) {
@@ -550,12 +841,42 @@ std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::
         return make_shared_entryIOC(node);
     } else if (auto node = ov::as_type_ptr<ov::opset1::Broadcast>(op)) {
         return make_shared_entryIOC(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset1::Transpose>(op)) {
+        return make_shared_entryIOC(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset1::Concat>(op)) {
+        return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v8::MaxPool>(op)) {
-        return std::make_shared<entryFallbackWithPadding<ov::op::v8::MaxPool>>(node);
+        return std::make_shared<entryPooling<ov::op::v8::MaxPool>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v1::MaxPool>(op)) {
-        return std::make_shared<entryFallbackWithPadding<ov::op::v1::MaxPool>>(node);
+        return std::make_shared<entryPooling<ov::op::v1::MaxPool>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v1::AvgPool>(op)) {
-        return std::make_shared<entryFallbackWithPadding<ov::op::v1::AvgPool>>(node);
+        return std::make_shared<entryPooling<ov::op::v1::AvgPool>>(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset5::GatherND>(op)) {
+        return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset8::GatherND>(op)) {
+        return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset8::Slice>(op)) {
+        return make_shared_entryIOC(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset2::ROIPooling>(op)) {
+        return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::op::v0::RNNCell>(op)) {
+        return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset3::GRUCell>(op)) {
+        return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset5::RNNSequence>(op)) {
+        return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset5::GRUSequence>(op)) {
+        return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset5::LSTMSequence>(op)) {
+        return make_shared_entryIO(node);
+    } else {
+        return nullptr;
+    }
+}
+
+static std::shared_ptr<IShapeInfer> make_shape_inference_entry(const std::shared_ptr<ngraph::Node>& op) {
+    if (auto shapeInfer = make_native_shape_inference(op)) {
+        return shapeInfer;
     } else if (auto node = ov::as_type_ptr<ov::op::v1::DeformableConvolution>(op)) {
         return std::make_shared<entryFallbackWithPadding<ov::op::v1::DeformableConvolution>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v8::DeformableConvolution>(op)) {
@@ -565,5 +886,9 @@ std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::
     }
 }
 
+bool has_native_shape_inference(const std::shared_ptr<ngraph::Node>& op) {
+    return make_native_shape_inference(op) != nullptr;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -8,6 +8,7 @@
 #include <openvino/core/core.hpp>
 #include <openvino/core/node.hpp>
 
+#include "cpu_types.h"
 #include "static_shape.hpp"
 
 namespace ov {
@@ -29,9 +30,48 @@ public:
     virtual const ov::CoordinateDiff& get_pads_end() = 0;
 
     virtual const std::vector<int64_t>& get_input_ranks() = 0;
+
+    // whether infer produces the pads
+    virtual bool has_pads() const = 0;
 };
 
-std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::Node>& op);
+/**
+ * @brief The inputs of the shape inference read in place, e.g. from the memory of the node input edges
+ */
+class IShapeInferInputs {
+public:
+    virtual const VectorDims& get_dims(size_t port) const = 0;
+    virtual ov::element::Type get_element_type(size_t port) const = 0;
+    virtual const void* get_data(size_t port) const = 0;
+};
+
+/**
+ * @brief The shape inference memoizing the results by the input shapes and the values of the inputs the output shapes
+ * depend on
+ */
+class IMemoizedShapeInfer : public IShapeInfer {
+public:
+    /**
+     * @brief Infers the output shapes of the inputs read in place. The memoized result is looked up before anything is
+     * allocated, so a repeated input costs the comparison only. The returned shapes are valid until the next call.
+     * @param value_port_mask the ports of the inputs the output shapes depend on the values of
+     */
+    virtual const std::vector<VectorDims>& infer(const IShapeInferInputs& inputs, uint32_t value_port_mask) = 0;
+
+    using IShapeInfer::infer;
+};
+
+/**
+ * @brief Creates the shape inference of the operation, which memoizes the results by the input shapes and the values of
+ * the inputs the output shapes depend on
+ */
+std::shared_ptr<IMemoizedShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::Node>& op);
+
+/**
+ * @brief Checks whether the operation has the static shape inference of its own, otherwise the shape inference falls
+ * back to the validation of the operation clone with the static input shapes
+ */
+bool has_native_shape_inference(const std::shared_ptr<ngraph::Node>& op);
 
 }   // namespace intel_cpu
 }   // namespace ov
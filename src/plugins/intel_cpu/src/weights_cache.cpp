@@ -10,7 +10,7 @@
 namespace ov {
 namespace intel_cpu {
 
-const SimpleDataHash WeightsSharing::simpleCRC;
+const SimpleDataHash WeightsSharing::simpleCRC{};
 
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
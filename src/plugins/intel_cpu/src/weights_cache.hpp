@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "weights_hash.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -25,26 +26,10 @@ namespace intel_cpu {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
+    // Computes 64-bit multi-lane CRC32C based hash, the implementation is selected at runtime according to the CPU ISA
     uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
+        return XARCH::weights_hash(data, size);
     }
-
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
 };
 
 /**
@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_hash.hpp"
+
+#include <cstring>
+#if defined(HAVE_SSE42)
+#include <immintrin.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+namespace {
+
+constexpr size_t kLanes = 4;
+
+#if defined(HAVE_SSE42)
+
+inline uint32_t crc32c_u8(uint32_t crc, uint8_t v) {
+    return _mm_crc32_u8(crc, v);
+}
+
+inline uint32_t crc32c_u32(uint32_t crc, uint32_t v) {
+    return _mm_crc32_u32(crc, v);
+}
+
+inline uint32_t crc32c_u64(uint32_t crc, uint64_t v) {
+#if defined(__x86_64__) || defined(_M_X64)
+    return static_cast<uint32_t>(_mm_crc32_u64(crc, v));
+#else
+    crc = _mm_crc32_u32(crc, static_cast<uint32_t>(v));
+    return _mm_crc32_u32(crc, static_cast<uint32_t>(v >> 32));
+#endif
+}
+
+#else
+
+struct Crc32cTable {
+    Crc32cTable() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int j = 0; j < 8; j++)
+                c = ((c & 1) ? 0x82f63b78 : 0) ^ (c >> 1);
+            table[i] = c;
+        }
+    }
+
+    uint32_t table[256];
+};
+
+const Crc32cTable crc32cTable;
+
+// bitwise identical to the crc32 instruction, i.e. the bytes are consumed in the little endian order
+inline uint32_t crc32c_u8(uint32_t crc, uint8_t v) {
+    return crc32cTable.table[(crc ^ v) & 0xff] ^ (crc >> 8);
+}
+
+inline uint32_t crc32c_u32(uint32_t crc, uint32_t v) {
+    for (size_t i = 0; i < sizeof(v); i++, v >>= 8)
+        crc = crc32c_u8(crc, static_cast<uint8_t>(v));
+    return crc;
+}
+
+inline uint32_t crc32c_u64(uint32_t crc, uint64_t v) {
+    for (size_t i = 0; i < sizeof(v); i++, v >>= 8)
+        crc = crc32c_u8(crc, static_cast<uint8_t>(v));
+    return crc;
+}
+
+#endif
+
+inline uint64_t load_u64(const unsigned char* ptr) {
+    uint64_t v;
+    std::memcpy(&v, ptr, sizeof(v));
+    return v;
+}
+
+}  // namespace
+
+uint64_t weights_hash(const unsigned char* data, size_t size) {
+    const size_t laneSize = size / (kLanes * sizeof(uint64_t)) * sizeof(uint64_t);
+
+    uint32_t crc[kLanes];
+    const unsigned char* ptr[kLanes];
+    for (size_t k = 0; k < kLanes; k++) {
+        // distinct seeds, so the equal chunks of the data don't produce equal lanes checksums
+        crc[k] = ~static_cast<uint32_t>(k);
+        ptr[k] = data + k * laneSize;
+    }
+
+    // the lanes don't depend on each other, so the crc32 latency is hidden by the pipelining
+    for (size_t i = 0; i < laneSize; i += sizeof(uint64_t)) {
+        crc[0] = crc32c_u64(crc[0], load_u64(ptr[0] + i));
+        crc[1] = crc32c_u64(crc[1], load_u64(ptr[1] + i));
+        crc[2] = crc32c_u64(crc[2], load_u64(ptr[2] + i));
+        crc[3] = crc32c_u64(crc[3], load_u64(ptr[3] + i));
+    }
+
+    // the tail directly follows the last lane
+    for (size_t i = kLanes * laneSize; i < size; i++)
+        crc[kLanes - 1] = crc32c_u8(crc[kLanes - 1], data[i]);
+
+    // the lanes are combined in the opposite orders to get two different 32-bit halves of the result
+    uint32_t lo = ~0u;
+    uint32_t hi = ~0u;
+    for (size_t k = 0; k < kLanes; k++) {
+        lo = crc32c_u32(lo, crc[k]);
+        hi = crc32c_u32(hi, crc[kLanes - 1 - k]);
+    }
+    const uint64_t size64 = size;
+    lo = crc32c_u32(lo, static_cast<uint32_t>(size64));
+    hi = crc32c_u32(hi, static_cast<uint32_t>(size64 >> 32));
+
+    return (static_cast<uint64_t>(~hi) << 32) | ~lo;
+}
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+namespace XARCH {
+
+/**
+ * @brief Computes 64-bit hash of the weights data.
+ * The data is split into several lanes which are processed independently by CRC32C (Castagnoli polynomial),
+ * so the hardware crc32 instruction (SSE4.2) is pipelined. The lanes checksums are combined into the final 64-bit value.
+ * All the ISA specific implementations produce the same result.
+ * @param data pointer to the data
+ * @param size size of the data in bytes
+ * @return 64-bit hash value
+ */
+uint64_t weights_hash(const unsigned char* data, size_t size);
+
+}  // namespace XARCH
+}  // namespace intel_cpu
+}  // namespace ov
@@ -10,6 +10,9 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
 #include <ie_system_conf.h>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <chrono>
+#include <iostream>
 #include <thread>
 
 using namespace ::testing;
@@ -140,6 +143,29 @@ TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE, sharedVar);
 }
 
+TEST_P(TaskExecutorTests, canRunTasksSubmittedFromTasks) {
+    auto taskExecutor = GetParam()();
+    // more tasks than a stream queue can hold, so the overflow path is covered as well
+    const int OUTER_TASKS = MAX_NUMBER_OF_TASKS_IN_QUEUE;
+    const int INNER_TASKS = 500;
+    std::atomic_int sharedVar = {0};
+    std::promise<void> done;
+    for (int i = 0; i < OUTER_TASKS; i++) {
+        taskExecutor->run([&] {
+            for (int k = 0; k < INNER_TASKS; k++) {
+                taskExecutor->run([&] {
+                    if (++sharedVar == OUTER_TASKS * INNER_TASKS) {
+                        done.set_value();
+                    }
+                });
+            }
+        });
+    }
+    auto future = done.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(60)));
+    ASSERT_EQ(OUTER_TASKS * INNER_TASKS, sharedVar);
+}
+
 class ASyncTaskExecutorTests : public TaskExecutorTests {};
 
 // TODO: Issue-11695
@@ -189,6 +215,64 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
+TEST_F(StreamsExecutorConfigTest, spinCountIsZeroByDefault) {
+    IStreamsExecutor::Config config;
+    ASSERT_EQ("0", config.GetConfig(PluginConfigInternalParams::KEY_CPU_THREADS_SPIN_COUNT).as<std::string>());
+}
+
+TEST_F(StreamsExecutorConfigTest, canSetSpinCount) {
+    IStreamsExecutor::Config config;
+    ASSERT_NO_THROW(config.SetConfig(PluginConfigInternalParams::KEY_CPU_THREADS_SPIN_COUNT, "100"));
+    ASSERT_EQ(100, config._threadSpinCount);
+    ASSERT_EQ("100", config.GetConfig(PluginConfigInternalParams::KEY_CPU_THREADS_SPIN_COUNT).as<std::string>());
+}
+
+TEST_F(StreamsExecutorConfigTest, throwsOnWrongSpinCount) {
+    IStreamsExecutor::Config config;
+    ASSERT_THROW(config.SetConfig(PluginConfigInternalParams::KEY_CPU_THREADS_SPIN_COUNT, "-1"), Exception);
+    ASSERT_THROW(config.SetConfig(PluginConfigInternalParams::KEY_CPU_THREADS_SPIN_COUNT, "abc"), Exception);
+}
+
+// Microbenchmark of the scheduling overhead, run with --gtest_also_run_disabled_tests --gtest_filter=*StreamsExecutorBenchmark*
+TEST(StreamsExecutorBenchmark, DISABLED_EmptyAndTinyTasks) {
+    const int NUMBER_OF_TASKS = 200000;
+    const int NUMBER_OF_PRODUCERS = 4;
+    for (int spinCount : {0, 1000}) {
+        for (int streams : {1, 2, 4, 8, 16, 32, 64}) {
+            for (int work : {0, 100}) {
+                IStreamsExecutor::Config config{"BenchmarkCPUStreamsExecutor", streams};
+                config._threadSpinCount = spinCount;
+                CPUStreamsExecutor executor{config};
+                std::atomic_int counter = {0};
+                std::promise<void> done;
+                auto task = [&] {
+                    volatile int sink = 0;
+                    for (int i = 0; i < work; i++) {
+                        sink = sink + i;
+                    }
+                    if (++counter == NUMBER_OF_TASKS) {
+                        done.set_value();
+                    }
+                };
+                auto start = std::chrono::steady_clock::now();
+                std::vector<std::thread> producers;
+                for (int p = 0; p < NUMBER_OF_PRODUCERS; p++) {
+                    producers.emplace_back([&] {
+                        for (int i = 0; i < NUMBER_OF_TASKS / NUMBER_OF_PRODUCERS; i++) {
+                            executor.run(task);
+                        }
+                    });
+                }
+                for (auto&& producer : producers) producer.join();
+                done.get_future().wait();
+                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                std::cout << "streams " << streams << " spin count " << spinCount << (work ? " tiny" : " empty")
+                          << " tasks: " << NUMBER_OF_TASKS / elapsed.count() << " tasks/s" << std::endl;
+            }
+        }
+    }
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -208,6 +292,12 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+        config._threadSpinCount = 100;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
@@ -233,6 +323,12 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+        config._threadSpinCount = 100;
+        return std::make_shared<CPUStreamsExecutor>(config);
     }
 );
 
@@ -26,6 +26,13 @@ INSTANTIATE_TEST_SUITE_P(nightly_RandomMajorNodes, HeteroSyntheticTest,
                                 ::testing::ValuesIn(HeteroTests::HeteroSyntheticTest::_randomMajorNodeFunctions)),
                         HeteroSyntheticTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_PipelinedStages, HeteroPipelinedTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<PluginParameter>{{"CPU0", "openvino_intel_cpu_plugin"}, {"TEMPLATE0", "openvino_template_plugin"}}),
+                                ::testing::ValuesIn(HeteroTests::HeteroSyntheticTest::withMajorNodesFunctions(
+                                        [] {return ngraph::builder::subgraph::makeConvPool2Relu2();}, {"Conv_1"}))),
+                        HeteroPipelinedTest::getTestCaseName);
+
 #endif // !OPENVINO_STATIC_LIBRARY
 
 }  // namespace
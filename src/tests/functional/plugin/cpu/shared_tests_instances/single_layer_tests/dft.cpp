@@ -100,8 +100,33 @@ const auto testCase4D = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU)
 );
 
+/* 1D DFT over the audio frames, the lengths are not powers of two */
+
+const std::vector<std::vector<size_t>> framesShapes = {
+    {4, 400, 2},
+    {2, 480, 2},
+};
+
+const std::vector<std::vector<int64_t>> framesAxes = {
+    {1}
+};
+
+const std::vector<std::vector<int64_t>> framesSignalSizes = {
+    {}, {397}
+};
+
+const auto testCaseFrames = ::testing::Combine(
+    ::testing::ValuesIn(framesShapes),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::ValuesIn(framesAxes),
+    ::testing::ValuesIn(framesSignalSizes),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
 
 INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_1d, DFTLayerTest, testCase1D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_2d, DFTLayerTest, testCase2D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_3d, DFTLayerTest, testCase3D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_4d, DFTLayerTest, testCase4D, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsDFT_frames, DFTLayerTest, testCaseFrames, DFTLayerTest::getTestCaseName);
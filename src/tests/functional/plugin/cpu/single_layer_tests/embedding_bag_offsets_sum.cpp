@@ -75,6 +75,9 @@ public:
         std::tie(inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex) = embParams;
 
         selectedType = makeSelectedTypeStr("ref", inType);
+        // the bf16 table is accumulated in fp32, the reference rounds every sum to bf16
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -164,5 +167,47 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagOffsetsSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_BF16Table, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                embBagOffsetSumArgSet,
+                ::testing::Values(ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+const std::vector<InputShape> input_shapes_skewed = {
+        {
+            // input model dynamic shapes
+            {ov::Dimension::dynamic(), ov::Dimension::dynamic()},
+            // input tensor shapes
+            {{10, 35}, {10, 67}}
+        },
+        // static shapes
+        {{10, 35}, {{10, 35}}},
+        {{10, 4, 17}, {{10, 4, 17}}},
+};
+
+// one bag takes almost all the indices, the others take one or none
+const std::vector<std::vector<size_t>> indices_skewed =
+        {{0, 3, 9, 1, 1, 4, 7, 2, 8, 5, 6, 0, 9, 3, 2, 2, 7, 8, 4, 1, 5, 6, 9, 0, 3}};
+const std::vector<std::vector<size_t>> offsets_skewed = {{0, 22, 22, 24}, {0, 1, 1, 1, 2}};
+
+const auto embBagOffsetSumSkewedArgSet = ::testing::Combine(
+        ::testing::ValuesIn(input_shapes_skewed),
+        ::testing::ValuesIn(indices_skewed),
+        ::testing::ValuesIn(offsets_skewed),
+        ::testing::ValuesIn(default_index),
+        ::testing::ValuesIn(with_weights),
+        ::testing::ValuesIn(with_default_index)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_SkewedBags, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                embBagOffsetSumSkewedArgSet,
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
\ No newline at end of file
@@ -68,6 +68,9 @@ protected:
         std::tie(inputShapes, indices, withWeights) = embParams;
 
         selectedType = makeSelectedTypeStr("ref", inType);
+        // the bf16 table is accumulated in fp32, the reference rounds every sum to bf16
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -148,5 +151,13 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagPackedSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_BF16Table, EmbeddingBagPackedSumLayerCPUTest,
+        ::testing::Combine(
+                embBagPackedSumArgSet,
+                ::testing::Values(ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -78,6 +78,9 @@ protected:
         std::tie(inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex) = embParams;
 
         selectedType = makeSelectedTypeStr("ref", inType);
+        // the bf16 table is accumulated in fp32, the reference rounds every sum to bf16
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -169,5 +172,50 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingSegmentsSumLayerCPUTest,
          ::testing::ValuesIn(indPrecisions),
          ::testing::Values(CommonTestUtils::DEVICE_CPU)),
          EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_BF16Table, EmbeddingSegmentsSumLayerCPUTest,
+     ::testing::Combine(
+         embSegmentsSumArgSet,
+         ::testing::Values(ElementType::bf16),
+         ::testing::Values(ElementType::i32),
+         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+         EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+const std::vector<InputShape> input_shapes_skewed = {
+    {
+        // input model dynamic shapes
+        {ov::Dimension::dynamic(), ov::Dimension::dynamic()},
+        // input tensor shapes
+        {{10, 35}, {10, 67}}
+    },
+    // static shapes
+    {{10, 35}, {{10, 35}}},
+    {{10, 4, 17}, {{10, 4, 17}}},
+};
+
+// the first segment takes almost all the indices, the others take one, two or none
+const std::vector<std::vector<size_t>> indices_skewed =
+    {{0, 3, 9, 1, 1, 4, 7, 2, 8, 5, 6, 0, 9, 3, 2, 2, 7, 8, 4, 1}};
+const std::vector<std::vector<size_t>> segment_ids_skewed =
+    {{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 4}};
+const std::vector<size_t> num_segments_skewed = {6};
+
+const auto embSegmentsSumSkewedArgSet = ::testing::Combine(
+    ::testing::ValuesIn(input_shapes_skewed),
+    ::testing::ValuesIn(indices_skewed),
+    ::testing::ValuesIn(segment_ids_skewed),
+    ::testing::ValuesIn(num_segments_skewed),
+    ::testing::ValuesIn(default_index),
+    ::testing::ValuesIn(with_weights),
+    ::testing::ValuesIn(with_default_index)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_SkewedSegments, EmbeddingSegmentsSumLayerCPUTest,
+     ::testing::Combine(
+         embSegmentsSumSkewedArgSet,
+         ::testing::Values(ElementType::f32, ElementType::bf16),
+         ::testing::Values(ElementType::i32),
+         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+         EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
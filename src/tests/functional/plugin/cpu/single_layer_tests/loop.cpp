@@ -6,6 +6,7 @@
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "ngraph_functions/builders.hpp"
 #include <common_test_utils/ov_tensor_utils.hpp>
+#include <openvino/runtime/core.hpp>
 
 using namespace InferenceEngine;
 using namespace ov;
@@ -477,5 +478,64 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForDiffShapesConcat, LoopForDiffShapesLayerCP
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// The number of the iterations is unknown before the execution, so the concatenation buffer grows while the loop
+// runs, and the slices are concatenated in the reverse order:
+//   i = 0
+//   do { i += 1; x += 1; out[reverse] <- x } while (i < limit)
+TEST(LoopConcatCPUTest, smoke_GrowingBufferNegativeStride) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto x = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+    auto limit = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::i64, ngraph::Shape{});
+
+    auto body_i = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::i64, ngraph::Shape{});
+    auto body_limit = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::i64, ngraph::Shape{});
+    auto body_x = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+    auto next_i = std::make_shared<ngraph::opset5::Add>(
+        body_i, ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {1}));
+    auto body_cond = std::make_shared<ngraph::opset5::Less>(next_i, body_limit);
+    auto next_x = std::make_shared<ngraph::opset5::Add>(
+        body_x, ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1.f}));
+    auto body = std::make_shared<ov::Model>(ngraph::OutputVector{body_cond, next_i, next_x},
+                                            ngraph::ParameterVector{body_i, body_limit, body_x});
+
+    auto loop = std::make_shared<ngraph::opset5::Loop>(
+        ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {-1}),
+        ngraph::opset5::Constant::create(ngraph::element::boolean, ngraph::Shape{}, {true}));
+    loop->set_function(body);
+    loop->set_special_body_ports(ngraph::opset5::Loop::SpecialBodyPorts{-1, 0});
+    auto init_i = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+    loop->set_merged_input(body_i, init_i, next_i);
+    loop->set_invariant_input(body_limit, limit);
+    loop->set_merged_input(body_x, x, next_x);
+    auto concat = loop->get_concatenated_slices(next_x, -1, -1, 1, 0, 0);
+
+    auto model = std::make_shared<ov::Model>(ngraph::OutputVector{concat}, ngraph::ParameterVector{x, limit});
+    ov::Core core;
+    auto request = core.compile_model(model, CommonTestUtils::DEVICE_CPU).create_infer_request();
+
+    ov::Tensor xTensor(ngraph::element::f32, {1, 3});
+    for (size_t c = 0; c < 3; c++)
+        xTensor.data<float>()[c] = static_cast<float>(10 * c);
+    request.set_tensor(x, xTensor);
+    // the buffer grows from one slice, then the other trip counts reuse the request
+    for (int64_t iterations : {11, 3, 17}) {
+        ov::Tensor limitTensor(ngraph::element::i64, {});
+        limitTensor.data<int64_t>()[0] = iterations;
+        request.set_tensor(limit, limitTensor);
+        request.infer();
+
+        const auto output = request.get_tensor(concat);
+        ASSERT_EQ(output.get_shape(), (ov::Shape{static_cast<size_t>(iterations), 3}));
+        // the slice of the iteration t is x + t + 1 and it's placed at the row iterations - 1 - t
+        for (size_t row = 0; row < static_cast<size_t>(iterations); row++) {
+            for (size_t c = 0; c < 3; c++) {
+                ASSERT_EQ(output.data<float>()[row * 3 + c], static_cast<float>(10 * c + iterations - row))
+                    << "iterations " << iterations << " row " << row;
+            }
+        }
+    }
+}
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+
+#include <fstream>
+#include <iterator>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the 1x1 convolution is forced to nhwc by the runtime info, which isn't serialized, so the imported
+// graph selects it only if the stored selection is applied, by default it selects a blocked layout):
+/*
+ *        Parameter
+ *            |
+ *        Conv 3x3
+ *            |
+ *        Conv 1x1 (nhwc)
+ *            |
+ *          Result
+ */
+
+class CompiledGraphExportTest : virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        cacheDir = "compiled_graph_export_test";
+        configuration.insert({ PluginConfigParams::KEY_CACHE_DIR, cacheDir });
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_EXPORT_COMPILED_GRAPH, PluginConfigParams::YES });
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{1, 32, 14, 14}});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(inputParams));
+
+        auto conv0 = ngraph::builder::makeConvolution(paramOuts[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 32, true);
+        auto conv1 = ngraph::builder::makeConvolution(conv0, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 16, false);
+        conv1->set_friendly_name("conv1");
+        conv1->get_rt_info() = makeCPUInfo({nhwc}, {nhwc}, {});
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(conv1)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "CompiledGraphExport");
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    // the implementation types and the output layouts of the executable graph nodes
+    std::map<std::string, std::string> getExecSelection() {
+        std::map<std::string, std::string> selection;
+        for (const auto& node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            const auto implType = rtInfo.find(ExecGraphInfoSerialization::IMPL_TYPE);
+            const auto layouts = rtInfo.find(ExecGraphInfoSerialization::OUTPUT_LAYOUTS);
+            if (implType == rtInfo.end() || layouts == rtInfo.end())
+                continue;
+            selection[node->get_friendly_name()] = implType->second.as<std::string>() + " " + layouts->second.as<std::string>();
+        }
+        return selection;
+    }
+
+    std::string cacheDir;
+};
+
+namespace {
+TEST_F(CompiledGraphExportTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the compiled graph selection is exported
+    Run();
+    const auto compiledSelection = getExecSelection();
+    const auto blobs = CommonTestUtils::listFilesWithExt(cacheDir, "blob");
+    ASSERT_EQ(blobs.size(), 1);
+    std::ifstream blob(blobs.front(), std::ios::binary);
+    const std::string content{std::istreambuf_iterator<char>(blob), std::istreambuf_iterator<char>()};
+    ASSERT_NE(content.find("compiled_graph"), std::string::npos);
+
+    const auto conv1Selection = compiledSelection.find("conv1");
+    ASSERT_NE(conv1Selection, compiledSelection.end());
+    ASSERT_EQ(nhwc, cpu_str2fmt(conv1Selection->second.substr(conv1Selection->second.find(' ') + 1).c_str()));
+
+    // the graph of the imported network has the same selection, so the stored one is applied and not dropped
+    // by the retry, which would select the blocked layout
+    Run();
+    ASSERT_EQ(compiledSelection, getExecSelection());
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
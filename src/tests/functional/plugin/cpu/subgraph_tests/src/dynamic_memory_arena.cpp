@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the intermediate edges are dynamic, so they are packed into the arena; the Softmax output lives across
+// the second MatMul, the quadratic MatMul output grows and shrinks with the shapes, so the plan is rebuilt):
+/*
+ *          Parameter
+ *              |
+ *           Softmax --------
+ *              |            |
+ *      MatMul (x, x^T)      |
+ *              |            |
+ *           Softmax         |
+ *              |            |
+ *            MatMul --------
+ *              |
+ *             Relu
+ *              |
+ *            Result
+ */
+
+class DynamicMemoryArenaTest : public testing::WithParamInterface<std::string>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        return "arena=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA, GetParam()});
+
+        // the shapes grow, shrink below the first one and grow again
+        InputShape dataShapes{{-1, -1, 16}, {{1, 8, 16}, {2, 32, 16}, {1, 4, 16}, {3, 64, 16}, {2, 32, 16}}};
+        init_input_shapes({dataShapes});
+
+        auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        auto softmax0 = std::make_shared<ngraph::opset1::Softmax>(inputParams[0], 2);
+        auto scores = std::make_shared<ngraph::opset1::MatMul>(softmax0, softmax0, false, true);
+        auto softmax1 = std::make_shared<ngraph::opset1::Softmax>(scores, 2);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax1, softmax0);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(matmul);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "DynamicMemoryArena");
+    }
+};
+
+TEST_P(DynamicMemoryArenaTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicMemoryArena, DynamicMemoryArenaTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         DynamicMemoryArenaTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
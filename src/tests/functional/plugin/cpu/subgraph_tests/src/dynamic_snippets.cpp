@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the eltwise chain is tokenized into a single snippet if the dynamic snippets are enabled):
+/*
+ *   Parameter    Parameter
+ *     |    \        /
+ *     |       Add
+ *     |        |
+ *     |     Sigmoid
+ *      \      /
+ *      Multiply
+ *          |
+ *        Result
+ */
+
+class DynamicSnippets : public testing::WithParamInterface<std::string>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        return "dynamicSnippets=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_DYNAMIC_SNIPPETS, GetParam()});
+
+        // the last shape is repeated, so the snippet takes its kernel from the runtime cache
+        InputShape dataShapes{{-1, -1, -1, -1}, {{1, 3, 16, 16}, {2, 3, 8, 5}, {1, 3, 16, 16}}};
+        InputShape scaleShapes{{1, -1, 1, 1}, {{1, 3, 1, 1}, {1, 3, 1, 1}, {1, 3, 1, 1}}};
+
+        init_input_shapes({dataShapes, scaleShapes});
+        auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        auto add = std::make_shared<ngraph::opset1::Add>(inputParams[0], inputParams[1]);
+        auto sigmoid = std::make_shared<ngraph::opset1::Sigmoid>(add);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(sigmoid, inputParams[0]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "DynamicSnippets");
+    }
+};
+
+TEST_P(DynamicSnippets, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    run();
+
+    const bool dynamicSnippets = GetParam() == InferenceEngine::PluginConfigParams::YES;
+    size_t nodes_found = 0;
+    for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+        if (n->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() == "Subgraph")
+            nodes_found++;
+    }
+    ASSERT_EQ(nodes_found, dynamicSnippets ? 1 : 0);
+
+    if (dynamicSnippets) {
+        // the kernels of the first two shapes are generated, the one of the repeated shape is found in the cache
+        const auto statistics = compiledModel.get_property(
+            InferenceEngine::PluginConfigInternalParams::METRIC_CPU_RUNTIME_CACHE_STATISTICS)
+                .as<std::map<std::string, uint64_t>>();
+        ASSERT_GE(statistics.at("misses"), 2);
+        ASSERT_GE(statistics.at("hits"), 1);
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicSnippets, DynamicSnippets,
+                         ::testing::Values(InferenceEngine::PluginConfigParams::YES,
+                                           InferenceEngine::PluginConfigParams::NO),
+                         DynamicSnippets::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,117 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include <ngraph/opsets/opset8.hpp>
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+
+namespace SubgraphTestsDefinitions {
+
+using namespace ngraph;
+
+/*
+   The constant embedding table, which is exact in fp16 or is the int8 table dequantized by the scale only,
+   is read by EmbeddingBagOffsetsSum as is:
+        Table (f32 or i8 -> Convert -> Multiply) -> EmbeddingBagOffsetsSum <- Parameter (per sample weights)
+   The int8 rows are dequantized while they are accumulated, so neither Convert nor Multiply is executed.
+   The bags are skewed: the first one takes most of the indices and the second one is empty.
+*/
+enum class TableType {
+    FP16,
+    I8_TENSOR_SCALE,
+    I8_ROW_SCALES
+};
+
+class EmbeddingBagCompressedTable : public testing::WithParamInterface<TableType>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TableType>& obj) {
+        switch (obj.param) {
+            case TableType::FP16: return "FP16";
+            case TableType::I8_TENSOR_SCALE: return "I8_TensorScale";
+            case TableType::I8_ROW_SCALES: return "I8_RowScales";
+        }
+        return "";
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        tableType = GetParam();
+
+        const size_t rows = 10, depth = 35;
+        const Shape tableShape{rows, depth};
+        // the values are exact both in fp16 and in int8
+        std::vector<float> values(rows * depth);
+        for (size_t i = 0; i < values.size(); i++)
+            values[i] = static_cast<float>(static_cast<int>(i % 17) - 8);
+
+        std::shared_ptr<Node> table;
+        if (tableType == TableType::FP16) {
+            table = opset8::Constant::create(element::f32, tableShape, values);
+        } else {
+            const auto quantized = opset8::Constant::create(element::i8, tableShape, values);
+            const auto convert = std::make_shared<opset8::Convert>(quantized, element::f32);
+            std::shared_ptr<Node> scales;
+            if (tableType == TableType::I8_TENSOR_SCALE) {
+                scales = opset8::Constant::create(element::f32, Shape{}, {0.5f});
+            } else {
+                std::vector<float> rowScales(rows);
+                for (size_t i = 0; i < rows; i++)
+                    rowScales[i] = 0.25f * static_cast<float>(i + 1);
+                scales = opset8::Constant::create(element::f32, Shape{rows, 1}, rowScales);
+            }
+            table = std::make_shared<opset8::Multiply>(convert, scales);
+        }
+
+        const std::vector<int32_t> indices{0, 3, 9, 1, 1, 4, 7, 2, 8, 5, 6, 0, 9, 3};
+        const std::vector<int32_t> offsets{0, 11, 11, 13};
+        const auto weights = std::make_shared<opset8::Parameter>(element::f32, Shape{indices.size()});
+        const auto embedding = std::make_shared<opset8::EmbeddingBagOffsetsSum>(
+            table,
+            opset8::Constant::create(element::i32, Shape{indices.size()}, indices),
+            opset8::Constant::create(element::i32, Shape{offsets.size()}, offsets),
+            opset8::Constant::create(element::i32, Shape{}, {0}),
+            weights);
+        function = std::make_shared<Function>(embedding, ParameterVector{weights});
+    }
+
+    void TearDown() override {
+        // the fp16 table needs F16C, which comes along with AVX2
+        std::string expectedPrecision = "FP32";
+        if (tableType != TableType::FP16)
+            expectedPrecision = "I8";
+        else if (InferenceEngine::with_cpu_x86_avx2())
+            expectedPrecision = "FP16";
+
+        auto exec_model = executableNetwork.GetExecGraphInfo().getFunction();
+        int embedding_nodes_found = 0;
+        for (const auto& n : exec_model->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>();
+            ASSERT_NE("Convert", layer_type);
+            ASSERT_NE("Eltwise", layer_type);
+            if (layer_type == "EmbeddingBagOffsetsSum") {
+                embedding_nodes_found++;
+                auto precision = n->get_rt_info().at(ExecGraphInfoSerialization::RUNTIME_PRECISION).as<std::string>();
+                ASSERT_EQ(expectedPrecision, precision);
+            }
+        }
+        ASSERT_EQ(embedding_nodes_found, 1);
+    }
+
+    TableType tableType;
+};
+
+TEST_P(EmbeddingBagCompressedTable, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagCompressedTable, EmbeddingBagCompressedTable,
+                         ::testing::Values(TableType::FP16, TableType::I8_TENSOR_SCALE, TableType::I8_ROW_SCALES),
+                         EmbeddingBagCompressedTable::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the weights and the workspace are larger than a huge page):
+/*
+ *        Parameter
+ *            |
+ *     FullyConnected 1024x2048
+ *            |
+ *          Relu
+ *            |
+ *     FullyConnected 2048x1024
+ *            |
+ *          Result
+ */
+
+using HugePagesParams = std::tuple<std::string,   // huge pages mode
+                                   std::string>;  // number of streams
+
+class HugePagesTest : public testing::WithParamInterface<HugePagesParams>,
+                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<HugePagesParams> obj) {
+        std::string mode, streams;
+        std::tie(mode, streams) = obj.param;
+        return "mode=" + mode + "_streams=" + streams;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::string mode, streams;
+        std::tie(mode, streams) = GetParam();
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_HUGE_PAGES, mode });
+        configuration.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams });
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{64, 1024}});
+        auto fc0 = ngraph::builder::makeFullyConnected(inputParams[0], ngPrc, 2048);
+        auto relu = std::make_shared<ngraph::opset8::Relu>(fc0);
+        auto fc1 = ngraph::builder::makeFullyConnected(relu, ngPrc, 1024);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(fc1)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "HugePages");
+    }
+};
+
+TEST_P(HugePagesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_HugePages, HugePagesTest,
+                         ::testing::Combine(::testing::Values(PluginConfigInternalParams::TRANSPARENT,
+                                                              PluginConfigInternalParams::EXPLICIT),
+                                            ::testing::Values("1", "2")),
+                         HugePagesTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (Inception-like block executed with inter-op parallelism):
+/*
+ *                   Parameter
+ *          /        |         \          \
+ *    Conv 1x1   Conv 1x1     Conv 1x1   MaxPool
+ *       |          |            |          |
+ *       |       Conv 3x3     Conv 5x5   Conv 1x1
+ *        \         |            |        /
+ *                     Concat
+ *                       |
+ *                     Result
+ */
+
+class InterOpParallelismTest : public testing::WithParamInterface<std::string>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "InterOpParallelism=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM, GetParam() });
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{1, 16, 14, 14}});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(inputParams));
+
+        auto makeConv = [&](const ngraph::Output<ngraph::Node>& in, size_t kernel, size_t channels) {
+            const ptrdiff_t pad = kernel / 2;
+            return ngraph::builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                                    ngraph::op::PadType::EXPLICIT, channels, true);
+        };
+
+        auto branch0 = makeConv(paramOuts[0], 1, 8);
+        auto branch1 = makeConv(makeConv(paramOuts[0], 1, 8), 3, 8);
+        auto branch2 = makeConv(makeConv(paramOuts[0], 1, 4), 5, 8);
+        auto pool = ngraph::builder::makePooling(paramOuts[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                 ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        auto branch3 = makeConv(pool, 1, 8);
+
+        auto concat = ngraph::builder::makeConcat({branch0, branch1, branch2, branch3}, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "InterOpParallelism");
+    }
+};
+
+namespace {
+    TEST_P(InterOpParallelismTest, CompareWithRefs) {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+        Run();
+    }
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterOpParallelism_CPU, InterOpParallelismTest,
+    testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+    InterOpParallelismTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
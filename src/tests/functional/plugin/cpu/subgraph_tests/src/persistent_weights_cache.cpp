@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *        Parameter
+ *            |
+ *        Conv 3x3 (weights are repacked into a blocked layout)
+ *            |
+ *        Conv 1x1
+ *            |
+ *          Result
+ */
+
+class PersistentWeightsCacheTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        cacheDir = "persistent_weights_cache_test";
+        configuration.insert({ PluginConfigParams::KEY_CACHE_DIR, cacheDir });
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_PERSISTENT_WEIGHTS_CACHE, PluginConfigParams::YES });
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{1, 32, 14, 14}});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(inputParams));
+
+        auto conv0 = ngraph::builder::makeConvolution(paramOuts[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 32, true);
+        auto conv1 = ngraph::builder::makeConvolution(conv0, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 16, true);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(conv1)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "PersistentWeightsCache");
+    }
+
+    void TearDown() override {
+        const auto weightsDir = CommonTestUtils::makePath(cacheDir, "cpu_weights");
+        CommonTestUtils::removeFilesWithExt(weightsDir, "bin");
+        CommonTestUtils::removeDir(weightsDir);
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    std::map<std::string, uint64_t> getStatistics() const {
+        return executableNetwork.GetMetric(PluginConfigInternalParams::METRIC_CPU_PERSISTENT_WEIGHTS_CACHE_STATISTICS)
+            .as<std::map<std::string, uint64_t>>();
+    }
+
+    std::string cacheDir;
+};
+
+namespace {
+TEST_F(PersistentWeightsCacheTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the weights are repacked and stored
+    Run();
+    const auto weightsDir = CommonTestUtils::makePath(cacheDir, "cpu_weights");
+    ASSERT_FALSE(CommonTestUtils::listFilesWithExt(weightsDir, "bin").empty());
+    auto statistics = getStatistics();
+    ASSERT_GT(statistics.at("stored"), 0);
+    ASSERT_EQ(statistics.at("restored"), 0);
+    const auto storedEntries = statistics.at("stored");
+
+    // the weights are restored from the cache instead of being repacked, the outputs are compared with the reference
+    Run();
+    statistics = getStatistics();
+    ASSERT_EQ(statistics.at("restored"), storedEntries);
+    ASSERT_EQ(statistics.at("stored"), 0);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+#include <cmath>
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the streams infer the different shapes at once, the runtime cache is shared among them):
+/*
+ *      Parameter [1, 8, ?, ?]
+ *            |
+ *     Interpolate x2
+ *            |
+ *      Convolution 3x3
+ *            |
+ *          Relu
+ *            |
+ *          Result
+ */
+
+namespace {
+std::shared_ptr<ov::Model> makeModel() {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 8, -1, -1});
+
+    ov::opset8::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = ov::opset8::Interpolate::InterpolateMode::LINEAR_ONNX;
+    attrs.shape_calculation_mode = ov::opset8::Interpolate::ShapeCalcMode::SCALES;
+    attrs.coordinate_transformation_mode = ov::opset8::Interpolate::CoordinateTransformMode::HALF_PIXEL;
+    auto sizes = ov::opset8::Constant::create(ov::element::i32, {2}, {1, 1});
+    auto scales = ov::opset8::Constant::create(ov::element::f32, {2}, {2.f, 2.f});
+    auto axes = ov::opset8::Constant::create(ov::element::i64, {2}, {2, 3});
+    auto interpolate = std::make_shared<ov::opset8::Interpolate>(param, sizes, scales, axes, attrs);
+
+    std::vector<float> weightsValues(8 * 8 * 3 * 3);
+    for (size_t i = 0; i < weightsValues.size(); i++)
+        weightsValues[i] = static_cast<float>(i % 7) / 7.f - 0.4f;
+    auto weights = ov::opset8::Constant::create(ov::element::f32, {8, 8, 3, 3}, weightsValues);
+    auto conv = std::make_shared<ov::opset8::Convolution>(interpolate, weights, ov::Strides{1, 1},
+                                                          ov::CoordinateDiff{1, 1}, ov::CoordinateDiff{1, 1},
+                                                          ov::Strides{1, 1});
+    auto relu = std::make_shared<ov::opset8::Relu>(conv);
+    auto result = std::make_shared<ov::opset8::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "RuntimeCacheSharing");
+}
+
+void checkValues(const ov::Tensor& expected, const ov::Tensor& actual) {
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    const auto expectedData = expected.data<float>();
+    const auto actualData = actual.data<float>();
+    for (size_t i = 0; i < expected.get_size(); i++) {
+        ASSERT_LE(std::abs(expectedData[i] - actualData[i]), 1e-4f * std::max(1.f, std::abs(expectedData[i])))
+            << "at " << i;
+    }
+}
+}  // namespace
+
+class RuntimeCacheSharingTest : public testing::WithParamInterface<std::string>, public testing::Test {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        return "sharing=" + obj.param;
+    }
+};
+
+TEST_P(RuntimeCacheSharingTest, ConcurrentStreams) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    constexpr size_t streams = 4;
+    constexpr size_t rounds = 5;
+    const std::vector<ov::Shape> shapes{{1, 8, 7, 9}, {1, 8, 12, 5}, {1, 8, 16, 16}, {1, 8, 3, 20}, {1, 8, 9, 7}};
+
+    ov::Core core;
+    auto model = makeModel();
+
+    // the reference is inferred by a single stream with a cache of its own
+    auto refModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                       {{PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING,
+                                         PluginConfigInternalParams::STREAM}});
+    auto refRequest = refModel.create_infer_request();
+    std::vector<ov::Tensor> inputs, expected;
+    for (size_t i = 0; i < shapes.size(); i++) {
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, shapes[i], 10, -5, 8, i));
+        refRequest.set_input_tensor(inputs.back());
+        refRequest.infer();
+        const auto output = refRequest.get_output_tensor();
+        expected.emplace_back(output.get_element_type(), output.get_shape());
+        output.copy_to(expected.back());
+    }
+
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                            {{PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING, GetParam()},
+                                             ov::num_streams(static_cast<int>(streams))});
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < streams; i++)
+        requests.push_back(compiledModel.create_infer_request());
+
+    // each round the requests switch the shapes, so the cached executors are reused by the other streams
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < streams; i++) {
+            requests[i].set_input_tensor(inputs[(i + round) % shapes.size()]);
+            requests[i].start_async();
+        }
+        for (size_t i = 0; i < streams; i++) {
+            requests[i].wait();
+            checkValues(expected[(i + round) % shapes.size()], requests[i].get_output_tensor());
+        }
+    }
+
+    const auto statistics = compiledModel.get_property(PluginConfigInternalParams::METRIC_CPU_RUNTIME_CACHE_STATISTICS)
+                                .as<std::map<std::string, uint64_t>>();
+    ASSERT_GT(statistics.at("hits"), 0);
+}
+
+TEST(RuntimeCacheStatisticsTest, smoke_ProcessCacheStatisticsPerNetwork) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto model = makeModel();
+    const ov::AnyMap config{{PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING,
+                             PluginConfigInternalParams::PROCESS}};
+    auto inferredModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, config);
+    auto idleModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, config);
+
+    const auto getStatistics = [](const ov::CompiledModel& compiledModel) {
+        return compiledModel.get_property(PluginConfigInternalParams::METRIC_CPU_RUNTIME_CACHE_STATISTICS)
+            .as<std::map<std::string, uint64_t>>();
+    };
+    const auto idleBefore = getStatistics(idleModel);
+
+    auto request = inferredModel.create_infer_request();
+    for (const auto& shape : {ov::Shape{1, 8, 7, 9}, ov::Shape{1, 8, 12, 5}, ov::Shape{1, 8, 7, 9}}) {
+        request.set_input_tensor(ov::test::utils::create_and_fill_tensor(ov::element::f32, shape, 10, -5));
+        request.infer();
+    }
+
+    // both networks use the process cache, but the lookups of the inferred one are not reported by the idle one
+    const auto inferred = getStatistics(inferredModel);
+    const auto idle = getStatistics(idleModel);
+    ASSERT_GT(inferred.at("hits"), 0);
+    ASSERT_GT(inferred.at("misses"), 0);
+    ASSERT_EQ(idle.at("hits"), idleBefore.at("hits"));
+    ASSERT_EQ(idle.at("misses"), idleBefore.at("misses"));
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_RuntimeCacheSharing, RuntimeCacheSharingTest,
+                         ::testing::Values(PluginConfigInternalParams::NETWORK, PluginConfigInternalParams::PROCESS),
+                         RuntimeCacheSharingTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <openvino/runtime/core.hpp>
+
+#include <algorithm>
+
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the model is static, the batch is switched at runtime):
+/*
+ *        Parameter
+ *            |
+ *     FullyConnected 16x32
+ *            |
+ *          Relu
+ *            |
+ *          Result
+ */
+
+using ShapeVariantsParams = std::string;  // maximal number of the graphs created for the other input shapes
+
+class ShapeVariantsTest : public testing::WithParamInterface<ShapeVariantsParams>,
+                          virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ShapeVariantsParams> obj) {
+        return "variants=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SHAPE_VARIANTS, GetParam()});
+
+        // the model shape goes first, the other batch sizes are repeated, so the cached graphs are reused or recreated
+        InputShape inputShapes{{8, 16}, {{8, 16}, {1, 16}, {4, 16}, {8, 16}, {1, 16}, {32, 16}, {4, 16}}};
+
+        init_input_shapes({inputShapes});
+        auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        auto fc = ngraph::builder::makeFullyConnected(inputParams.front(), ngPrc, 32);
+        auto relu = std::make_shared<ngraph::opset8::Relu>(fc);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "shapeVariants");
+    }
+};
+
+TEST_P(ShapeVariantsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+// Subgraph (the target shape of Reshape is folded to the model shape by the transformations):
+/*
+ *        Parameter
+ *        |       \
+ *        |     ShapeOf
+ *        |       /
+ *        Reshape
+ *           |
+ *         Relu
+ *           |
+ *         Result
+ */
+TEST(ShapeVariantsShapeOf, smoke_RefusedForShapeSubgraphs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{8, 16});
+    auto shapeOf = std::make_shared<ov::opset8::ShapeOf>(param);
+    auto reshape = std::make_shared<ov::opset8::Reshape>(param, shapeOf, false);
+    auto relu = std::make_shared<ov::opset8::Relu>(reshape);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(relu)},
+                                             ov::ParameterVector{param}, "shapeVariantsShapeOf");
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                            {{PluginConfigInternalParams::KEY_CPU_SHAPE_VARIANTS, "4"}});
+    auto request = compiledModel.create_infer_request();
+
+    // the graph for the other shape would keep the folded target shape, so only the model shape is accepted
+    ov::Tensor otherInput(ov::element::f32, {4, 16});
+    ASSERT_THROW(request.set_input_tensor(otherInput), ov::Exception);
+
+    ov::Tensor input(ov::element::f32, {8, 16});
+    for (size_t i = 0; i < input.get_size(); i++)
+        input.data<float>()[i] = static_cast<float>(i % 5) - 2.f;
+    request.set_input_tensor(input);
+    request.infer();
+    const auto output = request.get_output_tensor();
+    ASSERT_EQ(output.get_shape(), input.get_shape());
+    for (size_t i = 0; i < input.get_size(); i++)
+        ASSERT_EQ(output.data<float>()[i], std::max(0.f, input.data<float>()[i]));
+}
+
+// The output tensor is bound to the graph of the model shape and is reshaped by the inferences with the other shapes,
+// so it gets the model shape back before the graph writes to it
+TEST(ShapeVariantsOutputs, smoke_ModelShapeAfterOtherShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{8, 16});
+    auto relu = std::make_shared<ov::opset8::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(relu)},
+                                             ov::ParameterVector{param}, "shapeVariantsOutputs");
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                            {{PluginConfigInternalParams::KEY_CPU_SHAPE_VARIANTS, "2"}});
+    auto request = compiledModel.create_infer_request();
+    request.set_output_tensor(ov::Tensor(ov::element::f32, {8, 16}));
+
+    // the other shapes are both smaller and larger than the model one, so the output tensor is reallocated
+    for (const auto& shape : {ov::Shape{8, 16}, ov::Shape{2, 16}, ov::Shape{8, 16}, ov::Shape{32, 16},
+                              ov::Shape{8, 16}, ov::Shape{8, 16}}) {
+        ov::Tensor input(ov::element::f32, shape);
+        for (size_t i = 0; i < input.get_size(); i++)
+            input.data<float>()[i] = static_cast<float>((i + shape[0]) % 7) - 3.f;
+        request.set_input_tensor(input);
+        request.infer();
+        const auto output = request.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), shape);
+        for (size_t i = 0; i < input.get_size(); i++)
+            ASSERT_EQ(output.data<float>()[i], std::max(0.f, input.data<float>()[i])) << "shape " << shape;
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ShapeVariants, ShapeVariantsTest,
+                         ::testing::Values("1", "4"),
+                         ShapeVariantsTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/runtime/core.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+#include <algorithm>
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the state is read and written in place, the state buffers are swapped between the inferences):
+/*
+ *   ReadValue   Parameter
+ *         \      /
+ *           Add
+ *          /   \
+ *      Assign  Result
+ */
+
+namespace {
+std::shared_ptr<ov::Model> makeAccumulator() {
+    const ov::Shape shape{1, 16};
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{shape, ov::element::f32, "accumulator"});
+    auto init = ov::opset8::Constant::create(ov::element::f32, shape, {0.f});
+    auto read = std::make_shared<ov::opset8::ReadValue>(init, variable);
+    auto add = std::make_shared<ov::opset8::Add>(read, param);
+    auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+    auto result = std::make_shared<ov::opset8::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{param},
+                                       "StatefulZeroCopy");
+}
+
+// Subgraph (Multiply is the only consumer of its output, so it writes the new state into the state buffer directly):
+/*
+ *   ReadValue   Parameter
+ *         \      /
+ *           Add
+ *          /   \
+ *    Multiply  Result
+ *       |
+ *     Assign
+ */
+std::shared_ptr<ov::Model> makeScaledAccumulator() {
+    const ov::Shape shape{1, 16};
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{shape, ov::element::f32, "accumulator"});
+    auto init = ov::opset8::Constant::create(ov::element::f32, shape, {0.f});
+    auto read = std::make_shared<ov::opset8::ReadValue>(init, variable);
+    auto add = std::make_shared<ov::opset8::Add>(read, param);
+    auto scale = std::make_shared<ov::opset8::Multiply>(add, ov::opset8::Constant::create(ov::element::f32, {}, {2.f}));
+    auto assign = std::make_shared<ov::opset8::Assign>(scale, variable);
+    auto result = std::make_shared<ov::opset8::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{param},
+                                       "StatefulZeroCopyDirectWrite");
+}
+
+void checkValues(const ov::Tensor& tensor, float expected) {
+    const auto data = tensor.data<float>();
+    ASSERT_TRUE(std::all_of(data, data + tensor.get_size(), [&](float value) { return value == expected; }))
+        << "expected " << expected;
+}
+}  // namespace
+
+TEST(StatefulZeroCopy, smoke_AccumulateSetReset) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeAccumulator(), CommonTestUtils::DEVICE_CPU);
+    auto request = compiledModel.create_infer_request();
+    auto input = request.get_input_tensor();
+    std::fill_n(input.data<float>(), input.get_size(), 1.f);
+
+    // each inference reads the state written by the previous one
+    for (size_t step = 1; step <= 3; step++) {
+        request.infer();
+        checkValues(request.get_output_tensor(), static_cast<float>(step));
+    }
+    auto states = request.query_state();
+    ASSERT_EQ(states.size(), 1);
+    checkValues(states.front().get_state(), 3.f);
+
+    ov::Tensor newState(ov::element::f32, {1, 16});
+    std::fill_n(newState.data<float>(), newState.get_size(), 10.f);
+    states.front().set_state(newState);
+    request.infer();
+    checkValues(request.get_output_tensor(), 11.f);
+    checkValues(states.front().get_state(), 11.f);
+
+    states.front().reset();
+    request.infer();
+    checkValues(request.get_output_tensor(), 1.f);
+
+    // the states of the requests are independent
+    auto otherRequest = compiledModel.create_infer_request();
+    std::fill_n(otherRequest.get_input_tensor().data<float>(), input.get_size(), 2.f);
+    otherRequest.infer();
+    checkValues(otherRequest.get_output_tensor(), 2.f);
+    request.infer();
+    checkValues(request.get_output_tensor(), 2.f);
+}
+
+TEST(StatefulZeroCopy, smoke_DirectWriteSetReset) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeScaledAccumulator(), CommonTestUtils::DEVICE_CPU);
+    auto request = compiledModel.create_infer_request();
+    auto input = request.get_input_tensor();
+    std::fill_n(input.data<float>(), input.get_size(), 1.f);
+    auto states = request.query_state();
+    ASSERT_EQ(states.size(), 1);
+
+    // the output is the previous state plus one, the new state is the output doubled
+    float state = 0.f;
+    for (size_t step = 0; step < 4; step++) {
+        request.infer();
+        checkValues(request.get_output_tensor(), state + 1.f);
+        state = 2.f * (state + 1.f);
+        checkValues(states.front().get_state(), state);
+    }
+
+    ov::Tensor newState(ov::element::f32, {1, 16});
+    std::fill_n(newState.data<float>(), newState.get_size(), 10.f);
+    states.front().set_state(newState);
+    checkValues(states.front().get_state(), 10.f);
+    request.infer();
+    checkValues(request.get_output_tensor(), 11.f);
+    checkValues(states.front().get_state(), 22.f);
+    request.infer();
+    checkValues(request.get_output_tensor(), 23.f);
+    checkValues(states.front().get_state(), 46.f);
+
+    states.front().reset();
+    checkValues(states.front().get_state(), 0.f);
+    request.infer();
+    checkValues(request.get_output_tensor(), 1.f);
+    checkValues(states.front().get_state(), 2.f);
+    request.infer();
+    checkValues(request.get_output_tensor(), 3.f);
+    checkValues(states.front().get_state(), 6.f);
+
+    // the states of the requests are independent
+    auto otherRequest = compiledModel.create_infer_request();
+    std::fill_n(otherRequest.get_input_tensor().data<float>(), input.get_size(), 2.f);
+    otherRequest.infer();
+    checkValues(otherRequest.get_output_tensor(), 2.f);
+    checkValues(otherRequest.query_state().front().get_state(), 4.f);
+    request.infer();
+    checkValues(request.get_output_tensor(), 7.f);
+    checkValues(states.front().get_state(), 14.f);
+}
+
+}  // namespace SubgraphTestsDefinitions
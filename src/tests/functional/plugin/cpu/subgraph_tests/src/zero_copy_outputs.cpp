@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <openvino/runtime/core.hpp>
+
+#include <algorithm>
+
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the output of Relu is written directly to the output tensor):
+/*
+ *        Parameter
+ *            |
+ *     FullyConnected 16x32
+ *            |
+ *          Relu
+ *            |
+ *          Result
+ */
+
+class ZeroCopyOutputs : public SubgraphBaseTest {
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_ZERO_COPY_OUTPUTS, PluginConfigParams::YES});
+
+        // the output grows, shrinks and grows again, so the tensor is both reallocated and reused
+        InputShape inputShapes{{-1, 16}, {{4, 16}, {64, 16}, {1, 16}, {64, 16}, {128, 16}}};
+
+        init_input_shapes({inputShapes});
+        auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        auto fc = ngraph::builder::makeFullyConnected(inputParams.front(), ngPrc, 32);
+        auto relu = std::make_shared<ngraph::opset8::Relu>(fc);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "zeroCopyOutputs");
+    }
+};
+
+TEST_F(ZeroCopyOutputs, smoke_ZeroCopyOutputs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+std::shared_ptr<ov::Model> makeDoubleRelu() {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto scale = ov::opset8::Constant::create(ov::element::f32, {}, {2.f});
+    auto multiply = std::make_shared<ov::opset8::Multiply>(param, scale);
+    auto relu = std::make_shared<ov::opset8::Relu>(multiply);
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(relu)},
+                                       ov::ParameterVector{param}, "zeroCopyOutputsRequests");
+}
+
+ov::Tensor makeInput(size_t batch, float value) {
+    ov::Tensor input(ov::element::f32, {batch, 16});
+    for (size_t i = 0; i < input.get_size(); i++)
+        input.data<float>()[i] = (i % 2 ? -1.f : 1.f) * value;
+    return input;
+}
+
+void checkDoubleRelu(const ov::Tensor& input, const ov::Tensor& output) {
+    ASSERT_EQ(input.get_shape(), output.get_shape());
+    for (size_t i = 0; i < input.get_size(); i++)
+        ASSERT_EQ(output.data<float>()[i], std::max(0.f, 2.f * input.data<float>()[i])) << "at " << i;
+}
+}  // namespace
+
+// the requests share the graph, so the memory bound to the output of one request must be rebound for another one
+TEST(ZeroCopyOutputsRequests, smoke_RebindBetweenRequests) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeDoubleRelu(), CommonTestUtils::DEVICE_CPU,
+                                            {{PluginConfigInternalParams::KEY_CPU_ZERO_COPY_OUTPUTS,
+                                              PluginConfigParams::YES}, ov::num_streams(1)});
+    auto first = compiledModel.create_infer_request();
+    auto second = compiledModel.create_infer_request();
+    const auto firstInput = makeInput(8, 1.f);
+    const auto secondInput = makeInput(8, 3.f);
+    first.set_input_tensor(firstInput);
+    second.set_input_tensor(secondInput);
+
+    for (size_t i = 0; i < 3; i++) {
+        first.infer();
+        second.infer();
+        checkDoubleRelu(firstInput, first.get_output_tensor());
+        checkDoubleRelu(secondInput, second.get_output_tensor());
+    }
+}
+
+// the user tensors are never reshaped by the binding and the smaller ones are not overflown
+TEST(ZeroCopyOutputsRequests, smoke_UserOutputTensors) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeDoubleRelu(), CommonTestUtils::DEVICE_CPU,
+                                            {{PluginConfigInternalParams::KEY_CPU_ZERO_COPY_OUTPUTS,
+                                              PluginConfigParams::YES}});
+    auto request = compiledModel.create_infer_request();
+
+    const auto bigInput = makeInput(32, 1.f);
+    request.set_input_tensor(bigInput);
+    request.infer();
+
+    const auto smallInput = makeInput(4, 2.f);
+    ov::Tensor smallOutput(ov::element::f32, {4, 16});
+    request.set_input_tensor(smallInput);
+    request.set_output_tensor(smallOutput);
+    request.infer();
+    checkDoubleRelu(smallInput, smallOutput);
+
+    const auto sameInput = makeInput(4, 4.f);
+    request.set_input_tensor(sameInput);
+    request.infer();
+    ASSERT_EQ(request.get_output_tensor().data(), smallOutput.data());
+    checkDoubleRelu(sameInput, smallOutput);
+}
+
+} // namespace SubgraphTestsDefinitions
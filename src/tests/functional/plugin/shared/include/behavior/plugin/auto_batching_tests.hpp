@@ -2,7 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <memory>
@@ -158,6 +163,105 @@ public:
     }
 };
 
+// the synthetic load: the requests arrive with the fixed interval, returns the latencies (in ms) of the requests
+inline std::vector<double> RunSyntheticLoad(ExecutableNetwork& exec_net, size_t num_requests,
+                                            std::chrono::microseconds interval, size_t num_arrivals) {
+    using Clock = std::chrono::steady_clock;
+    std::vector<InferRequest> irs;
+    std::vector<Clock::time_point> starts(num_requests);
+    std::vector<double> latencies;
+    std::mutex latencies_mutex;
+    for (size_t r = 0; r < num_requests; r++) {
+        irs.push_back(exec_net.CreateInferRequest());
+        irs.back().SetCompletionCallback([&, r] {
+            std::lock_guard<std::mutex> lock(latencies_mutex);
+            latencies.push_back(std::chrono::duration<double, std::milli>(Clock::now() - starts[r]).count());
+        });
+    }
+    auto next_arrival = Clock::now();
+    for (size_t i = 0; i < num_arrivals; i++) {
+        std::this_thread::sleep_until(next_arrival);
+        next_arrival += interval;
+        auto& ir = irs[i % num_requests];
+        if (i >= num_requests)
+            ir.Wait(InferRequest::RESULT_READY);
+        starts[i % num_requests] = Clock::now();
+        ir.StartAsync();
+    }
+    for (auto& ir : irs)
+        ir.Wait(InferRequest::RESULT_READY);
+    std::sort(latencies.begin(), latencies.end());
+    return latencies;
+}
+
+using AutoBatchAdaptiveParams = std::tuple<
+        std::string,  // device name
+        size_t,       // batch size
+        size_t>;      // latency SLO, in ms
+
+class AutoBatching_Adaptive_Test : public CommonTestUtils::TestsCommon,
+                                   public testing::WithParamInterface<AutoBatchAdaptiveParams> {
+    void SetUp() override {
+        std::tie(device_name, num_batch, latency_slo) = this->GetParam();
+        fn_ptr = ngraph::builder::subgraph::makeSingleConv();
+    };
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchAdaptiveParams> &obj) {
+        size_t batch, slo;
+        std::string device_name;
+        std::tie(device_name, batch, slo) = obj.param;
+        return device_name + "_batch_size_" + std::to_string(batch) + "_latency_slo_" + std::to_string(slo);
+    }
+
+protected:
+    std::string device_name;
+    size_t num_batch;
+    size_t latency_slo;
+    std::shared_ptr<ngraph::Function> fn_ptr;
+
+    ExecutableNetwork LoadBatched(Core& ie, size_t timeout, size_t slo) {
+        std::map<std::string, std::string> config = {{CONFIG_KEY(AUTO_BATCH_TIMEOUT), std::to_string(timeout)},
+                                                     {CONFIG_KEY(AUTO_BATCH_LATENCY_SLO), std::to_string(slo)}};
+        return ie.LoadNetwork(CNNNetwork(fn_ptr), std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
+                                                  device_name + "(" + std::to_string(num_batch) + ")",
+                              config);
+    }
+};
+
+using AutoBatchPartialParams = std::tuple<
+        std::string,  // device name
+        size_t>;      // batch size
+
+class AutoBatching_Partial_Test : public CommonTestUtils::TestsCommon,
+                                  public testing::WithParamInterface<AutoBatchPartialParams> {
+    void SetUp() override {
+        std::tie(device_name, num_batch) = this->GetParam();
+        fn_ptr = ngraph::builder::subgraph::makeSingleConv();
+    };
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchPartialParams> &obj) {
+        size_t batch;
+        std::string device_name;
+        std::tie(device_name, batch) = obj.param;
+        return device_name + "_batch_size_" + std::to_string(batch);
+    }
+
+protected:
+    std::string device_name;
+    size_t num_batch;
+    std::shared_ptr<ngraph::Function> fn_ptr;
+
+    ExecutableNetwork LoadBatched(Core& ie, bool partial_batches) {
+        // minimal timeout, so the incomplete batches are executed right away
+        std::map<std::string, std::string> config = {
+            {CONFIG_KEY(AUTO_BATCH_TIMEOUT), "1"},
+            {CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES), partial_batches ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)}};
+        return ie.LoadNetwork(CNNNetwork(fn_ptr), std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
+                                                  device_name + "(" + std::to_string(num_batch) + ")",
+                              config);
+    }
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -166,4 +270,109 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Adaptive_Test, timeoutFollowsArrivalRate) {
+    const size_t max_timeout = 1000;
+    auto ie = InferenceEngine::Core();
+    auto exec_net = LoadBatched(ie, max_timeout, latency_slo);
+    const auto metrics = exec_net.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    ASSERT_NE(std::find(metrics.begin(), metrics.end(), METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT)), metrics.end());
+    ASSERT_NE(std::find(metrics.begin(), metrics.end(), METRIC_KEY(AUTO_BATCH_EFFECTIVE_BATCH_SIZE)), metrics.end());
+
+    // the rare arrivals can not fill the batch within the target, so the requests go to the batch1 right away
+    auto latencies = RunSyntheticLoad(exec_net, num_batch, std::chrono::milliseconds(latency_slo), 4 * num_batch);
+    ASSERT_EQ(latencies.size(), 4 * num_batch);
+    ASSERT_EQ(exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_EFFECTIVE_BATCH_SIZE)).as<unsigned int>(), 1);
+    ASSERT_LT(latencies.back(), static_cast<double>(max_timeout));
+
+    // back-to-back arrivals fill the batch, the timeout stays within the target
+    latencies = RunSyntheticLoad(exec_net, num_batch, std::chrono::microseconds(0), 16 * num_batch);
+    ASSERT_EQ(latencies.size(), 16 * num_batch);
+    ASSERT_LE(exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT)).as<unsigned int>(), latency_slo);
+
+    exec_net.SetConfig({{CONFIG_KEY(AUTO_BATCH_LATENCY_SLO), "0"}});
+    latencies = RunSyntheticLoad(exec_net, num_batch, std::chrono::microseconds(0), num_batch);
+    ASSERT_EQ(exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT)).as<unsigned int>(), max_timeout);
+    ASSERT_EQ(exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_EFFECTIVE_BATCH_SIZE)).as<unsigned int>(), num_batch);
+}
+
+// Comparison of the fixed AUTO_BATCH_TIMEOUT with the adaptive one over the range of the arrival rates.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*AutoBatching_Adaptive_Test*DISABLED_*
+TEST_P(AutoBatching_Adaptive_Test, DISABLED_SyntheticLoadBenchmark) {
+    const size_t fixed_timeout = 100;
+    const size_t num_arrivals = 64 * num_batch;
+    auto ie = InferenceEngine::Core();
+    for (auto interval_us : {0, 250, 1000, 5000, 20000}) {
+        const auto interval = std::chrono::microseconds(interval_us);
+        for (auto slo : {size_t(0), latency_slo}) {
+            auto exec_net = LoadBatched(ie, fixed_timeout, slo);
+            // warm-up to collect the statistics of the adaptive mode
+            RunSyntheticLoad(exec_net, 2 * num_batch, interval, 4 * num_batch);
+            const auto start = std::chrono::steady_clock::now();
+            const auto latencies = RunSyntheticLoad(exec_net, 2 * num_batch, interval, num_arrivals);
+            const std::chrono::duration<double> total = std::chrono::steady_clock::now() - start;
+            const auto mode = slo ? "adaptive, SLO " + std::to_string(slo) + " ms"
+                                  : "fixed " + std::to_string(fixed_timeout) + " ms";
+            std::cout << "interval " << interval_us << " us, " << mode
+                      << ": p50 " << latencies[latencies.size() / 2] << " ms"
+                      << ", p99 " << latencies[latencies.size() * 99 / 100] << " ms"
+                      << ", " << num_arrivals / total.count() << " FPS"
+                      << ", timeout " << exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT)).as<unsigned int>()
+                      << " ms, batch "
+                      << exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_EFFECTIVE_BATCH_SIZE)).as<unsigned int>()
+                      << std::endl;
+        }
+    }
+}
+
+TEST_P(AutoBatching_Partial_Test, comparePartialBatchesToSingleBatch) {
+    auto ie = InferenceEngine::Core();
+    auto exec_net = LoadBatched(ie, true);
+    auto net = CNNNetwork(fn_ptr);
+    const auto input = net.getInputsInfo().begin();
+    const auto output = net.getOutputsInfo().begin();
+    // the number of requests is not the multiple of the batch, so the rest is executed as the partial batches
+    const size_t num_requests = num_batch + num_batch - 1;
+    std::vector<InferRequest> irs;
+    std::vector<std::vector<uint8_t>> refs;
+    for (size_t i = 0; i < num_requests; i++) {
+        irs.push_back(exec_net.CreateInferRequest());
+        auto blob = FuncTestUtils::createAndFillBlob(input->second->getTensorDesc(), 10, 0, 1, static_cast<int>(i));
+        irs.back().SetBlob(input->first, blob);
+        const auto ptr = blob->cbuffer().as<const uint8_t*>();
+        const std::vector<uint8_t> in_data(ptr, ptr + blob->byteSize());
+        refs.push_back(ngraph::helpers::interpreterFunction(fn_ptr, {in_data}).front().second);
+    }
+    for (auto& ir : irs)
+        ir.StartAsync();
+    for (auto& ir : irs)
+        ir.Wait(InferRequest::RESULT_READY);
+
+    auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
+    for (size_t i = 0; i < num_requests; i++) {
+        auto out = irs[i].GetBlob(output->first);
+        FuncTestUtils::compareRawBuffers(out->buffer().as<float*>(), reinterpret_cast<const float*>(refs[i].data()),
+                                         out->size(), out->size(), thr);
+    }
+}
+
+// Throughput of the moderate load, when the number of the requests in flight does not fill the batch:
+// the incomplete batches are executed one by one vs as the partial batches.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*AutoBatching_Partial_Test*DISABLED_*
+TEST_P(AutoBatching_Partial_Test, DISABLED_ModerateLoadBenchmark) {
+    const size_t num_arrivals = 256 * num_batch;
+    auto ie = InferenceEngine::Core();
+    for (auto num_requests : {num_batch / 2, num_batch - 1, num_batch + num_batch / 2}) {
+        for (bool partial_batches : {false, true}) {
+            auto exec_net = LoadBatched(ie, partial_batches);
+            RunSyntheticLoad(exec_net, num_requests, std::chrono::microseconds(0), 4 * num_batch);
+            const auto start = std::chrono::steady_clock::now();
+            const auto latencies = RunSyntheticLoad(exec_net, num_requests, std::chrono::microseconds(0), num_arrivals);
+            const std::chrono::duration<double> total = std::chrono::steady_clock::now() - start;
+            std::cout << num_requests << " requests, " << (partial_batches ? "partial batches" : "batch1 fallback")
+                      << ": " << num_arrivals / total.count() << " FPS"
+                      << ", p50 " << latencies[latencies.size() / 2] << " ms" << std::endl;
+        }
+    }
+}
+
 }  // namespace AutoBatchingTests
\ No newline at end of file
@@ -51,4 +51,8 @@ struct HeteroSyntheticTest : public testing::WithParamInterface<HeteroSyntheticT
     std::vector<std::string> _registredPlugins;
 };
 
+struct HeteroPipelinedTest : public HeteroSyntheticTest {
+    void CheckPipelinedRequests(std::size_t stageRequests, std::size_t requestsNumber);
+};
+
 }  //  namespace HeteroTests
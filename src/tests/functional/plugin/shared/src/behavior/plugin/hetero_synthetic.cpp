@@ -9,6 +9,7 @@
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
 #include "ie_algorithm.hpp"
+#include "ie_plugin_config.hpp"
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -184,4 +185,48 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+void HeteroPipelinedTest::CheckPipelinedRequests(std::size_t stageRequests, std::size_t requestsNumber) {
+    configuration[HETERO_CONFIG_KEY(PIPELINE_STAGE_REQUESTS)] = std::to_string(stageRequests);
+    LoadNetwork();
+    GenerateInputs();
+    const auto expectedOutputs = CalculateRefs();
+
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (std::size_t i = 0; i < requestsNumber; ++i) {
+        inferRequest = executableNetwork.CreateInferRequest();
+        ConfigureInferRequest();
+        requests.push_back(inferRequest);
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::RESULT_READY));
+    }
+    for (auto&& request : requests) {
+        inferRequest = request;
+        Compare(expectedOutputs, GetOutputs());
+    }
+
+    const auto utilization = executableNetwork.GetMetric(METRIC_KEY(HETERO_PIPELINE_STAGES_UTILIZATION))
+                                 .as<std::map<std::string, float>>();
+    ASSERT_FALSE(utilization.empty());
+    for (auto&& stage : utilization) {
+        ASSERT_GT(stage.second, 0.f) << stage.first;
+        ASSERT_LE(stage.second, 1.f) << stage.first;
+    }
+}
+
+TEST_P(HeteroPipelinedTest, pipelinedRequestsMatchReference) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    CheckPipelinedRequests(1, 4);
+}
+
+TEST_P(HeteroPipelinedTest, unlimitedStagesMatchReference) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    CheckPipelinedRequests(0, 4);
+}
+
 }  //  namespace HeteroTests
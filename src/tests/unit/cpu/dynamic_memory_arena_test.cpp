@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <dynamic_memory_arena.h>
+
+using namespace ov::intel_cpu;
+
+TEST(DynamicMemoryArenaTest, SlotsArePackedByLifetime) {
+    auto arena = std::make_shared<DynamicMemoryArena>();
+    auto mngr0 = arena->registerSlot(0, 1);
+    auto mngr1 = arena->registerSlot(1, 2);
+    auto mngr2 = arena->registerSlot(2, 3);
+
+    // nothing has been requested yet
+    ASSERT_FALSE(arena->updatePlan());
+
+    // the first requests are served by the private buffers
+    mngr0->resize(100);
+    mngr1->resize(200);
+    mngr2->resize(100);
+    ASSERT_NE(mngr0->getRawPtr(), nullptr);
+    ASSERT_FALSE(mngr0->hasExtBuffer());
+
+    ASSERT_TRUE(arena->updatePlan());
+    // slots 0 and 2 don't intersect in time, so they share the same region
+    ASSERT_EQ(arena->getWorkspaceSize(), 128 + 256);
+    ASSERT_EQ(mngr0->getRawPtr(), mngr2->getRawPtr());
+    ASSERT_NE(mngr0->getRawPtr(), mngr1->getRawPtr());
+    ASSERT_TRUE(mngr1->hasExtBuffer());
+}
+
+TEST(DynamicMemoryArenaTest, WorkspaceGrowsMonotonically) {
+    auto arena = std::make_shared<DynamicMemoryArena>();
+    auto mngr0 = arena->registerSlot(0, 1);
+    auto mngr1 = arena->registerSlot(1, 2);
+
+    mngr0->resize(1000);
+    mngr1->resize(1000);
+    ASSERT_TRUE(arena->updatePlan());
+    const auto initialSize = arena->getWorkspaceSize();
+    auto* ptr = mngr0->getRawPtr();
+
+    // the smaller requests fit into the assigned regions and don't invalidate the plan
+    ASSERT_FALSE(mngr0->resize(10));
+    ASSERT_FALSE(arena->updatePlan());
+    ASSERT_EQ(mngr0->getRawPtr(), ptr);
+
+    // the bigger one falls back to a private buffer until the next plan update
+    ASSERT_TRUE(mngr1->resize(5000));
+    ASSERT_FALSE(mngr1->hasExtBuffer());
+    ASSERT_TRUE(arena->updatePlan());
+    ASSERT_GT(arena->getWorkspaceSize(), initialSize);
+    ASSERT_TRUE(mngr1->hasExtBuffer());
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <nodes/common/fft.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<float> generateSignal(size_t length) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> data(2 * length);
+    for (auto& value : data)
+        value = distribution(generator);
+    return data;
+}
+
+std::vector<double> referenceDFT(const std::vector<float>& data, bool inverse) {
+    const size_t length = data.size() / 2;
+    std::vector<double> result(data.size());
+    for (size_t k = 0; k < length; k++) {
+        double sumRe = 0.0, sumIm = 0.0;
+        for (size_t n = 0; n < length; n++) {
+            const double angle = (inverse ? 2.0 : -2.0) * M_PI * static_cast<double>((k * n) % length) / length;
+            sumRe += data[2 * n] * std::cos(angle) - data[2 * n + 1] * std::sin(angle);
+            sumIm += data[2 * n] * std::sin(angle) + data[2 * n + 1] * std::cos(angle);
+        }
+        result[2 * k] = inverse ? sumRe / length : sumRe;
+        result[2 * k + 1] = inverse ? sumIm / length : sumIm;
+    }
+    return result;
+}
+
+void checkExecutor(size_t length, bool inverse) {
+    auto data = generateSignal(length);
+    const auto expected = referenceDFT(data, inverse);
+
+    FFTExecutor executor(length, inverse);
+    std::vector<float> buffer(executor.getBufferSize());
+    executor.execute(data.data(), buffer.data());
+
+    double maxError = 0.0, maxValue = 0.0;
+    for (size_t i = 0; i < data.size(); i++) {
+        maxError = std::max(maxError, std::fabs(expected[i] - data[i]));
+        maxValue = std::max(maxValue, std::fabs(expected[i]));
+    }
+    ASSERT_LE(maxError, 1e-5 * std::max(maxValue, 1.0)) << "length " << length << (inverse ? " inverse" : " forward");
+}
+
+}  // namespace
+
+TEST(FFTExecutorTest, SmallLengths) {
+    for (size_t length = 1; length <= 64; length++) {
+        checkExecutor(length, false);
+        checkExecutor(length, true);
+    }
+}
+
+TEST(FFTExecutorTest, MixedRadixLengths) {
+    for (size_t length : {400, 480, 1000, 1029, 2048}) {
+        checkExecutor(length, false);
+        checkExecutor(length, true);
+    }
+}
+
+TEST(FFTExecutorTest, BluesteinLengths) {
+    for (size_t length : {11, 97, 401, 1009}) {
+        checkExecutor(length, false);
+        checkExecutor(length, true);
+    }
+}
+
+TEST(FFTExecutorTest, InverseRestoresSignal) {
+    const size_t length = 478;
+    const auto signal = generateSignal(length);
+    auto data = signal;
+    FFTExecutor forward(length, false), inverse(length, true);
+    std::vector<float> buffer(std::max(forward.getBufferSize(), inverse.getBufferSize()));
+    forward.execute(data.data(), buffer.data());
+    inverse.execute(data.data(), buffer.data());
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_NEAR(data[i], signal[i], 1e-5);
+}
+
+// Comparison with the O(N^2) DFT over the precomputed N x N twiddles used for these lengths before.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*FFTExecutorBenchmark*
+TEST(FFTExecutorBenchmark, DISABLED_AudioFrames) {
+    const int iterations = 1000;
+    for (size_t length : {400, 480, 1009}) {
+        auto data = generateSignal(length);
+
+        std::vector<std::pair<float, float>> twiddles(length * length);
+        for (size_t k = 0; k < length; k++) {
+            for (size_t n = 0; n < length; n++) {
+                const float phase = 2.0f * static_cast<float>(M_PI) * static_cast<float>(n * k) / static_cast<float>(length);
+                twiddles[k * length + n] = {std::cos(phase), -std::sin(phase)};
+            }
+        }
+        std::vector<float> naiveOutput(2 * length);
+        auto start = std::chrono::steady_clock::now();
+        for (int iter = 0; iter < iterations; iter++) {
+            for (size_t k = 0; k < length; k++) {
+                float sumRe = 0.f, sumIm = 0.f;
+                for (size_t n = 0; n < length; n++) {
+                    const auto& w = twiddles[k * length + n];
+                    sumRe += data[2 * n] * w.first - data[2 * n + 1] * w.second;
+                    sumIm += data[2 * n] * w.second + data[2 * n + 1] * w.first;
+                }
+                naiveOutput[2 * k] = sumRe;
+                naiveOutput[2 * k + 1] = sumIm;
+            }
+        }
+        std::chrono::duration<double, std::micro> naive = std::chrono::steady_clock::now() - start;
+
+        FFTExecutor executor(length, false);
+        std::vector<float> buffer(executor.getBufferSize());
+        std::vector<float> fftData;
+        start = std::chrono::steady_clock::now();
+        for (int iter = 0; iter < iterations; iter++) {
+            fftData = data;
+            executor.execute(fftData.data(), buffer.data());
+        }
+        std::chrono::duration<double, std::micro> fft = std::chrono::steady_clock::now() - start;
+
+        std::cout << "length " << length << ": naive " << naive.count() / iterations << " us, "
+                  << "mixed radix / Bluestein " << fft.count() / iterations << " us" << std::endl;
+    }
+}
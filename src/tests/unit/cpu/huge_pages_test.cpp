@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpu_memory.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+constexpr size_t hugePageSize = MemoryMngrWithHugePages::hugePageSize;
+}  // namespace
+
+TEST(HugePagesMemoryMngrTest, SmallBuffersUseOrdinaryPages) {
+    MemoryMngrWithHugePages mngr(HugePagesMode::Transparent);
+    ASSERT_TRUE(mngr.resize(1024));
+    ASSERT_NE(mngr.getRawPtr(), nullptr);
+    ASSERT_FALSE(mngr.isHugePagesBacked());
+    ASSERT_FALSE(mngr.hasExtBuffer());
+}
+
+TEST(HugePagesMemoryMngrTest, DisabledModeUsesOrdinaryPages) {
+    MemoryMngrWithHugePages mngr(HugePagesMode::Disabled);
+    ASSERT_TRUE(mngr.resize(4 * hugePageSize));
+    ASSERT_FALSE(mngr.isHugePagesBacked());
+}
+
+TEST(HugePagesMemoryMngrTest, LargeBuffersAreUsable) {
+    for (auto mode : {HugePagesMode::Transparent, HugePagesMode::Explicit}) {
+        MemoryMngrWithHugePages mngr(mode);
+        ASSERT_TRUE(mngr.resize(3 * hugePageSize + 1));
+        auto* data = static_cast<uint8_t*>(mngr.getRawPtr());
+        ASSERT_NE(data, nullptr);
+        // the huge pages may be unavailable, the fallback must work in the same way
+        if (mngr.isHugePagesBacked())
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % hugePageSize, 0);
+        std::memset(data, 0x5a, 3 * hugePageSize + 1);
+        ASSERT_EQ(data[3 * hugePageSize], 0x5a);
+
+        // no reallocation for the smaller sizes
+        ASSERT_FALSE(mngr.resize(hugePageSize));
+        ASSERT_EQ(mngr.getRawPtr(), data);
+        ASSERT_TRUE(mngr.resize(8 * hugePageSize));
+    }
+}
+
+TEST(HugePagesMemoryMngrTest, ExternalBufferIsNotOwned) {
+    MemoryMngrWithHugePages mngr(HugePagesMode::Transparent);
+    ASSERT_TRUE(mngr.resize(2 * hugePageSize));
+    std::vector<uint8_t> external(16);
+    mngr.setExtBuff(external.data(), external.size());
+    ASSERT_TRUE(mngr.hasExtBuffer());
+    ASSERT_FALSE(mngr.isHugePagesBacked());
+    ASSERT_EQ(mngr.getRawPtr(), external.data());
+}
+
+// Microbenchmark of the TLB pressure: FC-like row traversal of 256 MB of weights in the random order.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*HugePagesBenchmark*
+TEST(HugePagesBenchmark, DISABLED_WeightsTraversal) {
+    const size_t rows = 8192, cols = 8192;
+    std::vector<size_t> order(rows);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    for (auto mode : {HugePagesMode::Disabled, HugePagesMode::Transparent, HugePagesMode::Explicit}) {
+        MemoryMngrWithHugePages mngr(mode);
+        mngr.resize(rows * cols * sizeof(float));
+        auto* weights = static_cast<float*>(mngr.getRawPtr());
+        for (size_t i = 0; i < rows * cols; i++)
+            weights[i] = static_cast<float>(i % 7);
+
+        std::vector<float> dst(rows);
+        auto start = std::chrono::steady_clock::now();
+        for (int iter = 0; iter < 10; iter++) {
+            for (auto row : order) {
+                const float* src = weights + row * cols;
+                float acc = 0.f;
+                for (size_t col = 0; col < cols; col += 16)
+                    acc += src[col];
+                dst[row] = acc;
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "mode " << static_cast<int>(mode) << (mngr.isHugePagesBacked() ? " (huge pages)" : " (ordinary pages)")
+                  << ": " << elapsed.count() << " s, checksum " << std::accumulate(dst.begin(), dst.end(), 0.f) << std::endl;
+    }
+}
@@ -0,0 +1,164 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_cache_manager.hpp>
+#include <serialize.h>
+#include <ngraph/opsets/opset8.hpp>
+#include <openvino/util/mmap_object.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <sstream>
+#include <thread>
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+namespace {
+
+class NetworkCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // unique entries let the tests run in parallel
+        std::stringstream ss;
+        ss << ::testing::UnitTest::GetInstance()->current_test_info()->name() << "_" << std::this_thread::get_id()
+           << "_" << std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        id = ss.str();
+
+        const auto param = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4});
+        const auto weights = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{1, 4}, values);
+        const auto add = std::make_shared<ngraph::opset8::Add>(param, weights);
+        const auto result = std::make_shared<ngraph::opset8::Result>(add);
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param});
+    }
+
+    void TearDown() override {
+        cache().removeCacheEntry(id);
+    }
+
+    ICacheManager& cache() {
+        return manager;
+    }
+
+    void writeNetwork() {
+        cache().writeCacheEntry(id, [&](std::ostream& stream) {
+            CNNNetworkSerializer serializer(stream, std::make_shared<ExtensionManager>());
+            serializer << CNNNetwork(function);
+        });
+    }
+
+    std::string readEntry() {
+        std::string content;
+        cache().readCacheEntry(id, [&](std::istream& stream) {
+            content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        });
+        return content;
+    }
+
+    void writeEntry(const std::string& content) {
+        cache().writeCacheEntry(id, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    const std::vector<float> values = {1.f, 2.f, 3.f, 4.f};
+    std::shared_ptr<ngraph::Function> function;
+    std::string id;
+
+private:
+    FileStorageCacheManager manager{"."};
+};
+
+}  // namespace
+
+TEST_F(NetworkCacheTest, MappedImportAliasesWeights) {
+    writeNetwork();
+
+    bool isRead = false;
+    cache().readCacheEntry(id, [&](std::istream& stream) {
+        auto mmapStream = dynamic_cast<ov::util::MmapStream*>(&stream);
+        ASSERT_NE(mmapStream, nullptr);
+        const auto mapped = mmapStream->get_memory();
+
+        CNNNetworkDeserializer deserializer(stream, [&](const std::string& model, const Blob::CPtr& weights) {
+            EXPECT_FALSE(model.empty());
+            EXPECT_NE(model.find("<net"), std::string::npos);
+            EXPECT_NE(weights, nullptr);
+            if (weights) {
+                // the constants alias the mapped file instead of the copy of it
+                const auto data = weights->cbuffer().as<const char*>();
+                EXPECT_GE(data, mapped->data());
+                EXPECT_LE(data + weights->byteSize(), mapped->data() + mapped->size());
+                EXPECT_GE(weights->byteSize(), values.size() * sizeof(float));
+                EXPECT_EQ(std::search(data, data + weights->byteSize(),
+                                      reinterpret_cast<const char*>(values.data()),
+                                      reinterpret_cast<const char*>(values.data() + values.size())),
+                          data);
+            }
+            return CNNNetwork(function);
+        });
+        CNNNetwork network;
+        deserializer >> network;
+        EXPECT_EQ(network.getInputsInfo().size(), 1u);
+        EXPECT_EQ(network.getOutputsInfo().size(), 1u);
+        isRead = true;
+    });
+    ASSERT_TRUE(isRead);
+}
+
+TEST_F(NetworkCacheTest, MappedImportThrowsOnTruncatedEntry) {
+    writeNetwork();
+    const auto content = readEntry();
+    ASSERT_FALSE(content.empty());
+    writeEntry(content.substr(0, content.size() / 2));
+
+    cache().readCacheEntry(id, [&](std::istream& stream) {
+        ASSERT_NE(dynamic_cast<ov::util::MmapStream*>(&stream), nullptr);
+        CNNNetworkDeserializer deserializer(stream, [&](const std::string&, const Blob::CPtr&) {
+            return CNNNetwork(function);
+        });
+        CNNNetwork network;
+        EXPECT_THROW(deserializer >> network, NetworkNotRead);
+    });
+}
+
+TEST_F(NetworkCacheTest, RewriteKeepsMappedEntry) {
+    writeEntry("old entry");
+
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+    cache().readCacheEntry(id, [&](std::istream& stream) {
+        auto mmapStream = dynamic_cast<ov::util::MmapStream*>(&stream);
+        ASSERT_NE(mmapStream, nullptr);
+        mapped = mmapStream->get_memory();
+    });
+    ASSERT_NE(mapped, nullptr);
+
+#ifndef _WIN32
+    // the mapped file is replaced, not truncated, so the readers keep the old content
+    writeEntry("new entry");
+    EXPECT_EQ(std::string(mapped->data(), mapped->size()), "old entry");
+    EXPECT_EQ(readEntry(), "new entry");
+#endif
+}
+
+TEST_F(NetworkCacheTest, FailedWriteKeepsOldEntry) {
+    writeEntry("old entry");
+
+    EXPECT_THROW(cache().writeCacheEntry(id, [](std::ostream& stream) {
+        stream << "partial";
+        IE_THROW() << "Export failed";
+    }), Exception);
+    EXPECT_EQ(readEntry(), "old entry");
+}
+
+TEST_F(NetworkCacheTest, WriteThrowsWhenEntryCannotBeCreated) {
+    FileStorageCacheManager missingDir("missing_cache_dir_" + id);
+    ICacheManager& missingDirCache = missingDir;
+    EXPECT_THROW(missingDirCache.writeCacheEntry(id, [](std::ostream& stream) {
+        stream << "entry";
+    }), Exception);
+}
@@ -0,0 +1,188 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <nodes/embedding_bag_sum.h>
+#include <utils/bfloat16.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <openvino/core/type/float16.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+
+// the indices of the recommender models: a few hot rows take most of the lookups, the bag sizes follow a power law too
+struct Batch {
+    std::vector<int> indices;
+    std::vector<int> offsets;
+};
+
+Batch generatePowerLawBatch(size_t rows, size_t bags, size_t maxBagSize) {
+    std::mt19937 generator(42);
+
+    std::vector<double> rowWeights(rows);
+    for (size_t r = 0; r < rows; r++)
+        rowWeights[r] = 1.0 / std::pow(static_cast<double>(r + 1), 1.1);
+    std::discrete_distribution<size_t> rowDistribution(rowWeights.begin(), rowWeights.end());
+    // the hot rows are scattered over the table
+    std::vector<int> rowIds(rows);
+    std::iota(rowIds.begin(), rowIds.end(), 0);
+    std::shuffle(rowIds.begin(), rowIds.end(), generator);
+
+    // the empty bags are allowed
+    std::vector<double> sizeWeights(maxBagSize + 1);
+    sizeWeights[0] = 0.05;
+    for (size_t s = 1; s <= maxBagSize; s++)
+        sizeWeights[s] = 1.0 / std::pow(static_cast<double>(s), 1.5);
+    std::discrete_distribution<size_t> sizeDistribution(sizeWeights.begin(), sizeWeights.end());
+
+    Batch batch;
+    for (size_t b = 0; b < bags; b++) {
+        batch.offsets.push_back(static_cast<int>(batch.indices.size()));
+        const size_t size = sizeDistribution(generator);
+        for (size_t i = 0; i < size; i++)
+            batch.indices.push_back(rowIds[rowDistribution(generator)]);
+    }
+    return batch;
+}
+
+// the bags of EmbeddingBagOffsetsSum without the per sample weights, read from the vectors instead of the node inputs
+class TestEmbeddingBag : public node::EmbeddingBagSum {
+public:
+    TestEmbeddingBag(const Batch& batch, size_t rows, size_t depth, const Precision& tablePrecision,
+                     std::vector<float> scales, bool withKernel)
+        : EmbeddingBagSum(makeOp(batch, rows, depth), 3lu, 1lu, 4lu, 3lu), _batch(batch) {
+        setTableScales(std::move(scales));
+        prepareParams({rows, depth});
+        if (withKernel)
+            createKernel(tablePrecision);
+    }
+
+protected:
+    void initFromInputs() override {}
+
+    void getIndices(int embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeights) override {
+        const size_t begin = _batch.offsets[embIndex];
+        const size_t end = static_cast<size_t>(embIndex) + 1 < _batch.offsets.size() ?
+            _batch.offsets[embIndex + 1] : _batch.indices.size();
+        size = end - begin;
+        indices = size ? _batch.indices.data() + begin : nullptr;
+        weightsIdx = static_cast<int>(begin);
+        withWeights = false;
+    }
+
+private:
+    static std::shared_ptr<ngraph::Node> makeOp(const Batch& batch, size_t rows, size_t depth) {
+        return std::make_shared<ngraph::opset3::EmbeddingBagOffsetsSum>(
+            std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{rows, depth}),
+            std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{batch.indices.size()}),
+            std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{batch.offsets.size()}));
+    }
+
+    const Batch& _batch;
+};
+
+// the table in its own precision and the same table dequantized to fp32, as the graph converted it before
+struct Table {
+    Precision precision;
+    std::vector<uint8_t> data;
+    std::vector<float> scales;
+    std::vector<float> dequantized;
+};
+
+template <typename TTable>
+Table makeTable(const Precision& precision, size_t rows, size_t depth, bool withRowScales) {
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> distribution(-100, 100);
+    Table table;
+    table.precision = precision;
+    table.data.resize(rows * depth * sizeof(TTable));
+    table.dequantized.resize(rows * depth);
+    auto* data = reinterpret_cast<TTable*>(table.data.data());
+    if (withRowScales) {
+        table.scales.resize(rows);
+        for (size_t r = 0; r < rows; r++)
+            table.scales[r] = 0.01f * static_cast<float>(r % 13 + 1);
+    }
+    for (size_t i = 0; i < rows * depth; i++) {
+        const int value = distribution(generator);
+        data[i] = withRowScales ? static_cast<TTable>(value) : static_cast<TTable>(0.125f * static_cast<float>(value));
+        table.dequantized[i] = static_cast<float>(data[i]) * (withRowScales ? table.scales[i / depth] : 1.f);
+    }
+    return table;
+}
+
+std::vector<Table> makeTables(size_t rows, size_t depth) {
+    return {makeTable<float>(Precision::FP32, rows, depth, false),
+            makeTable<bfloat16_t>(Precision::BF16, rows, depth, false),
+            makeTable<ov::float16>(Precision::FP16, rows, depth, false),
+            makeTable<int8_t>(Precision::I8, rows, depth, true)};
+}
+
+std::vector<float> runEmbeddingBag(const Batch& batch, size_t rows, size_t depth, const Precision& precision,
+                                   const uint8_t* table, const std::vector<float>& scales, bool withKernel,
+                                   int iterations = 1, double* usPerIteration = nullptr) {
+    TestEmbeddingBag embeddingBag(batch, rows, depth, precision, scales, withKernel);
+    std::vector<float> output(batch.offsets.size() * depth);
+    const auto start = std::chrono::steady_clock::now();
+    for (int iter = 0; iter < iterations; iter++) {
+        embeddingBag.execute(table, nullptr, reinterpret_cast<uint8_t*>(output.data()), precision,
+                             {rows, depth}, {batch.offsets.size(), depth});
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    if (usPerIteration)
+        *usPerIteration = elapsed.count() / iterations;
+    return output;
+}
+
+}  // namespace
+
+// The kernel (or the scalar fallback without AVX2) over each table is checked against the scalar accumulation
+// of the dequantized fp32 table. The depth leaves a tail after the vectors.
+TEST(EmbeddingBagKernelTest, PowerLawIndices) {
+    const size_t rows = 1000, depth = 35;
+    const auto batch = generatePowerLawBatch(rows, 64, 64);
+    for (const auto& table : makeTables(rows, depth)) {
+        const auto expected = runEmbeddingBag(batch, rows, depth, Precision::FP32,
+                                              reinterpret_cast<const uint8_t*>(table.dequantized.data()), {}, false);
+        const auto actual = runEmbeddingBag(batch, rows, depth, table.precision, table.data.data(), table.scales, true);
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_NEAR(expected[i], actual[i], 1e-5f * std::max(1.f, std::fabs(expected[i])))
+                << table.precision << " table, element " << i;
+    }
+}
+
+// Comparison with the scalar accumulation of the fp32 table, which is what the graph ran before: the bf16, fp16
+// and int8 tables were converted (and scaled) to fp32 by the preceding nodes. The scalar accumulation of the
+// compact table is the fallback without AVX2.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*EmbeddingBagBenchmark*
+TEST(EmbeddingBagBenchmark, DISABLED_PowerLawIndices) {
+    const size_t rows = 200000, depth = 64, bags = 4096;
+    const int iterations = 50;
+    const auto batch = generatePowerLawBatch(rows, bags, 128);
+    std::cout << bags << " bags, " << batch.indices.size() << " indices over " << rows << " x " << depth
+              << " table" << std::endl;
+    for (const auto& table : makeTables(rows, depth)) {
+        double fp32Scalar = 0.0, scalar = 0.0, jit = 0.0;
+        runEmbeddingBag(batch, rows, depth, Precision::FP32, reinterpret_cast<const uint8_t*>(table.dequantized.data()),
+                        {}, false, iterations, &fp32Scalar);
+        runEmbeddingBag(batch, rows, depth, table.precision, table.data.data(), table.scales, false,
+                        iterations, &scalar);
+        runEmbeddingBag(batch, rows, depth, table.precision, table.data.data(), table.scales, true,
+                        iterations, &jit);
+        std::cout << table.precision << (table.scales.empty() ? "" : " scaled") << " table: fp32 scalar "
+                  << fp32Scalar << " us, scalar " << scalar << " us, jit " << jit << " us, speedup "
+                  << fp32Scalar / jit << "x" << std::endl;
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <numa_memory.h>
+#include <memory_desc/dnnl_blocked_memory_desc.h>
+
+#include <vector>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+
+MemoryPtr createMemory(size_t size) {
+    auto memory = std::make_shared<Memory>(dnnl::engine(dnnl::engine::kind::cpu, 0));
+    memory->Create(DnnlBlockedMemoryDesc(Precision::I8, Shape(SizeVector{size})));
+    return memory;
+}
+
+uint64_t getPagesNumber(const NumaMemoryStatistics& statistics) {
+    return statistics.localPages + statistics.remotePages + statistics.unknownPages;
+}
+
+}  // namespace
+
+TEST(NumaMemoryTest, FirstTouchZeroesMemory) {
+    std::vector<uint8_t> data(3 * 4096 + 17, 0xff);
+    firstTouch(data.data(), data.size());
+    for (auto v : data)
+        ASSERT_EQ(v, 0);
+}
+
+TEST(NumaMemoryTest, StatisticsCoverInnerPages) {
+    const size_t size = 1 << 20;
+    auto memory = createMemory(size);
+    firstTouch(memory->GetData(), size);
+    bindToNumaNode(memory->GetData(), size, 0);
+
+    const auto statistics = getNumaMemoryStatistics(memory->GetData(), size, 0);
+    ASSERT_GT(getPagesNumber(statistics), 0);
+    ASSERT_LE(getPagesNumber(statistics), size / 4096);
+}
+
+TEST(NumaMemoryTest, BindingToWrongNodeFails) {
+    std::vector<uint8_t> data(1 << 16);
+    ASSERT_FALSE(bindToNumaNode(data.data(), data.size(), -1));
+    ASSERT_FALSE(bindToNumaNode(data.data(), data.size(), 1 << 20));
+}
+
+TEST(NumaMemoryTest, TrackerSkipsReleasedMemory) {
+    const size_t size = 1 << 20;
+    NumaMemoryTracker tracker;
+    auto memory = createMemory(size);
+    firstTouch(memory->GetData(), size);
+    tracker.track(memory, 0);
+    {
+        auto released = createMemory(size);
+        tracker.track(released, 0);
+    }
+    const auto statistics = tracker.getStatistics();
+    ASSERT_EQ(getPagesNumber(statistics), getPagesNumber(getNumaMemoryStatistics(memory->GetData(), size, 0)));
+}
@@ -8,6 +8,7 @@
 #include <gmock/gmock.h>
 
 #include "cache/lru_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "cache/multi_cache.h"
 
 using namespace ov::intel_cpu;
@@ -96,6 +97,75 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(LruCacheTests, EvictionsCount) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), capacity);
+}
+
+TEST(ShardedLruCacheTests, SingleShardLruPolicy) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), 3);
+}
+
+TEST(ShardedLruCacheTests, Shards) {
+    constexpr size_t capacity = 64;
+    constexpr size_t shards = 8;
+    ShardedLruCache<IntKey, int> cache(capacity, shards);
+    ASSERT_EQ(cache.getCapacity(), capacity);
+
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    // the records are evicted per shard, so the stored and evicted records must sum up to the inserted ones
+    size_t stored = 0;
+    for (int i = 1; i <= capacity; ++i) {
+        auto result = cache.get({i});
+        ASSERT_TRUE(result == i || result == int());
+        stored += result == i;
+    }
+    ASSERT_EQ(stored + cache.getEvictionsCount(), capacity);
+
+    ASSERT_NO_THROW(cache.evict(capacity));
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), capacity);
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr size_t attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity, 4);
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -379,3 +449,157 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr size_t capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity);
+
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+        cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+    }
+
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, capacity);
+    ASSERT_EQ(statistics.misses, 3 * capacity);
+    ASSERT_EQ(statistics.evictions, capacity);
+}
+
+TEST(MultiCacheTests, SharedAmongThreads) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 100;
+    constexpr size_t numThreads = 8;
+    constexpr size_t numKeys = 50;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity, numThreads);
+
+    auto testRoutine = [&]() {
+        for (int iter = 0; iter < 10; ++iter) {
+            for (int i = 0; i < numKeys; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, numThreads * 10 * numKeys);
+    // a key may be built concurrently by several threads, but never more than once per thread
+    ASSERT_GE(statistics.misses, numKeys);
+    ASSERT_LE(statistics.misses, numKeys * numThreads);
+    ASSERT_EQ(statistics.evictions, 0);
+}
+
+namespace {
+struct StreamValue {
+    std::thread::id owner;
+};
+
+struct ShareableValue {
+    int data;
+};
+} // namespace
+
+namespace ov {
+namespace intel_cpu {
+template<>
+struct is_stream_shareable<std::shared_ptr<ShareableValue>> : std::true_type {};
+}   // namespace intel_cpu
+}   // namespace ov
+
+TEST(MultiCacheTests, StreamCachesShareOnlyShareableValues) {
+    constexpr size_t capacity = 10;
+
+    auto sharedCache = std::make_shared<MultiCache>(capacity, 2);
+    MultiCache firstStreamCache(capacity, sharedCache);
+    MultiCache secondStreamCache(capacity, sharedCache);
+
+    auto streamBuilder = [](const IntKey&) { return std::make_shared<StreamValue>(); };
+    auto shareableBuilder = [](const IntKey& key) {
+        return std::make_shared<ShareableValue>(ShareableValue{key.data});
+    };
+
+    auto firstStream = firstStreamCache.getOrCreate(IntKey{1}, streamBuilder);
+    auto secondStream = secondStreamCache.getOrCreate(IntKey{1}, streamBuilder);
+    ASSERT_EQ(firstStream.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(secondStream.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_NE(firstStream.first, secondStream.first);
+
+    auto firstShareable = firstStreamCache.getOrCreate(IntKey{1}, shareableBuilder);
+    auto secondShareable = secondStreamCache.getOrCreate(IntKey{1}, shareableBuilder);
+    ASSERT_EQ(firstShareable.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(secondShareable.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(firstShareable.first, secondShareable.first);
+
+    ASSERT_EQ(firstStreamCache.getStatistics().misses, 1);
+    ASSERT_EQ(secondStreamCache.getStatistics().misses, 1);
+    ASSERT_EQ(sharedCache->getStatistics().misses, 1);
+    ASSERT_EQ(sharedCache->getStatistics().hits, 1);
+    // each stream cache counts only its own lookups of the shared cache
+    ASSERT_EQ(firstStreamCache.getSharedLookupStatistics().misses, 1);
+    ASSERT_EQ(firstStreamCache.getSharedLookupStatistics().hits, 0);
+    ASSERT_EQ(secondStreamCache.getSharedLookupStatistics().misses, 0);
+    ASSERT_EQ(secondStreamCache.getSharedLookupStatistics().hits, 1);
+}
+
+TEST(MultiCacheTests, StreamCachesConcurrently) {
+    constexpr size_t capacity = 100;
+    constexpr size_t numThreads = 8;
+    constexpr int numKeys = 50;
+
+    auto sharedCache = std::make_shared<MultiCache>(capacity, numThreads);
+
+    auto streamBuilder = [](const IntKey&) {
+        return std::make_shared<StreamValue>(StreamValue{std::this_thread::get_id()});
+    };
+    auto shareableBuilder = [](const IntKey& key) {
+        return std::make_shared<ShareableValue>(ShareableValue{key.data});
+    };
+
+    auto testRoutine = [&]() {
+        MultiCache streamCache(capacity, sharedCache);
+        for (int iter = 0; iter < 10; ++iter) {
+            for (int i = 0; i < numKeys; ++i) {
+                auto streamResult = streamCache.getOrCreate(IntKey{i}, streamBuilder);
+                ASSERT_EQ(streamResult.first->owner, std::this_thread::get_id());
+                auto shareableResult = streamCache.getOrCreate(IntKey{i}, shareableBuilder);
+                ASSERT_EQ(shareableResult.first->data, i);
+            }
+        }
+        auto statistics = streamCache.getStatistics();
+        ASSERT_EQ(statistics.misses, numKeys);
+        ASSERT_EQ(statistics.hits, 9 * numKeys);
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    auto statistics = sharedCache->getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, numThreads * 10 * numKeys);
+    ASSERT_GE(statistics.misses, numKeys);
+    ASSERT_LE(statistics.misses, numKeys * numThreads);
+}
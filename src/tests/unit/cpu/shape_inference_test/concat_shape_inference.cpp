@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/ops.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeInferenceTest, ConcatTest) {
+    auto param0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto param1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto param2 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto concat = std::make_shared<op::v0::Concat>(OutputVector{param0, param1, param2}, -1);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{2, 3, 1}, StaticShape{2, 3, 5}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(concat.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 3, 10}));
+
+    // the dimensions except the concatenation axis must be equal
+    static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{2, 2, 1}, StaticShape{2, 3, 5}};
+    ASSERT_THROW(shape_inference(concat.get(), static_input_shapes, static_output_shapes), ov::NodeValidationFailure);
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <embeddingbag_packed_shape_inference.hpp>
+
+#include "utils.hpp"
+
+using namespace ov;
+using namespace ov::intel_cpu;
+using namespace std;
+
+TEST(StaticShapeInferenceTest, EmbeddingBagPackedSumV3) {
+    auto emb_table = make_shared<op::v0::Parameter>(element::f32, ov::PartialShape::dynamic());
+    auto indices = make_shared<op::v0::Parameter>(element::i64, ov::PartialShape::dynamic());
+    auto per_sample_weights = make_shared<op::v0::Parameter>(element::f32, ov::PartialShape::dynamic());
+
+    auto ebps = make_shared<op::v3::EmbeddingBagPackedSum>(emb_table, indices, per_sample_weights);
+
+    check_static_shape(ebps.get(), {StaticShape{5, 2}, StaticShape{3, 4}, StaticShape{3, 4}}, {StaticShape{3, 2}});
+}
@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gather_nd_shape_inference.hpp>
+
+#include "utils.hpp"
+
+using namespace ov;
+using namespace ov::intel_cpu;
+using namespace std;
+
+TEST(StaticShapeInferenceTest, GatherNDV5FusesBatchDims) {
+    auto data = make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto indices = make_shared<op::v0::Parameter>(element::i32, PartialShape::dynamic());
+    auto gather_nd = make_shared<op::v5::GatherND>(data, indices, 2);
+
+    check_static_shape(gather_nd.get(), {StaticShape{2, 3, 4, 5}, StaticShape{2, 3, 1}}, {StaticShape{6, 5}});
+    check_static_shape(gather_nd.get(), {StaticShape{2, 3, 4, 5}, StaticShape{2, 3, 7, 2}}, {StaticShape{6, 7}});
+}
+
+TEST(StaticShapeInferenceTest, GatherNDV8KeepsBatchDims) {
+    auto data = make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto indices = make_shared<op::v0::Parameter>(element::i32, PartialShape::dynamic());
+    auto gather_nd = make_shared<op::v8::GatherND>(data, indices, 2);
+
+    check_static_shape(gather_nd.get(), {StaticShape{2, 3, 4, 5}, StaticShape{2, 3, 1}}, {StaticShape{2, 3, 5}});
+    check_static_shape(gather_nd.get(), {StaticShape{2, 3, 4, 5}, StaticShape{2, 3, 7, 2}}, {StaticShape{2, 3, 7}});
+}
+
+TEST(StaticShapeInferenceTest, GatherNDNoBatchDims) {
+    auto data = make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto indices = make_shared<op::v0::Parameter>(element::i32, PartialShape::dynamic());
+    auto gather_nd = make_shared<op::v8::GatherND>(data, indices);
+
+    check_static_shape(gather_nd.get(), {StaticShape{10, 20, 30}, StaticShape{4, 5, 2}}, {StaticShape{4, 5, 30}});
+    EXPECT_THROW(check_static_shape(gather_nd.get(), {StaticShape{10, 20}, StaticShape{4, 3}}, {StaticShape{}}),
+                 NodeValidationFailure);
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/core/coordinate_diff.hpp>
+#include <openvino/op/max_pool.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/reshape.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeInferenceTest, MemoizedByInputValues) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto pattern = std::make_shared<op::v0::Parameter>(element::i64, PartialShape{2});
+    auto reshape = std::make_shared<op::v1::Reshape>(data, pattern, false);
+    auto shapeInfer = make_shape_inference(reshape);
+
+    int64_t pattern_val[] = {4, 6};
+    std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> constant_data;
+    constant_data[1] = std::make_shared<ngraph::runtime::HostTensor>(element::i64, ov::Shape{2}, pattern_val);
+    const std::vector<StaticShape> input_shapes = {{2, 12}, {2}};
+
+    ASSERT_EQ(shapeInfer->infer(input_shapes, constant_data)[0], (StaticShape{4, 6}));
+    // the same input shapes, but the other pattern value
+    pattern_val[0] = 3;
+    pattern_val[1] = 8;
+    ASSERT_EQ(shapeInfer->infer(input_shapes, constant_data)[0], (StaticShape{3, 8}));
+    pattern_val[0] = 4;
+    pattern_val[1] = 6;
+    ASSERT_EQ(shapeInfer->infer(input_shapes, constant_data)[0], (StaticShape{4, 6}));
+}
+
+TEST(StaticShapeInferenceTest, MemoizedPads) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto maxPool = std::make_shared<op::v1::MaxPool>(data,
+                                                     Strides{2, 2},
+                                                     Shape{0, 0},
+                                                     Shape{0, 0},
+                                                     Shape{3, 3},
+                                                     op::RoundingType::FLOOR,
+                                                     op::PadType::SAME_UPPER);
+    auto shapeInfer = make_shape_inference(maxPool);
+
+    ASSERT_EQ(shapeInfer->infer({{1, 3, 8, 8}}, {})[0], (StaticShape{1, 3, 4, 4}));
+    ASSERT_EQ(shapeInfer->get_pads_end(), (CoordinateDiff{1, 1}));
+    ASSERT_EQ(shapeInfer->infer({{1, 3, 9, 9}}, {})[0], (StaticShape{1, 3, 5, 5}));
+    ASSERT_EQ(shapeInfer->get_pads_end(), (CoordinateDiff{1, 1}));
+    ASSERT_EQ(shapeInfer->get_pads_begin(), (CoordinateDiff{1, 1}));
+    // the result of the first input shape is taken from the cache together with its pads
+    ASSERT_EQ(shapeInfer->infer({{1, 3, 8, 8}}, {})[0], (StaticShape{1, 3, 4, 4}));
+    ASSERT_EQ(shapeInfer->get_pads_begin(), (CoordinateDiff{0, 0}));
+    ASSERT_EQ(shapeInfer->get_pads_end(), (CoordinateDiff{1, 1}));
+}
+
+namespace {
+class TestInputs : public IShapeInferInputs {
+public:
+    const VectorDims& get_dims(size_t port) const override {
+        return dims[port];
+    }
+
+    element::Type get_element_type(size_t) const override {
+        return element::i64;
+    }
+
+    const void* get_data(size_t port) const override {
+        return data[port];
+    }
+
+    std::vector<VectorDims> dims;
+    std::vector<const void*> data;
+};
+}  // namespace
+
+TEST(StaticShapeInferenceTest, MemoizedInPlace) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto pattern = std::make_shared<op::v0::Parameter>(element::i64, PartialShape{2});
+    auto reshape = std::make_shared<op::v1::Reshape>(data, pattern, false);
+    auto shapeInfer = make_shape_inference(reshape);
+
+    int64_t pattern_val[] = {4, 6};
+    TestInputs inputs;
+    inputs.dims = {{2, 12}, {2}};
+    inputs.data = {nullptr, pattern_val};
+
+    const auto& first = shapeInfer->infer(inputs, 0x2);
+    ASSERT_EQ(first, (std::vector<VectorDims>{{4, 6}}));
+    // the hit returns the memoized shapes themselves
+    ASSERT_EQ(&shapeInfer->infer(inputs, 0x2), &first);
+
+    pattern_val[0] = 3;
+    pattern_val[1] = 8;
+    ASSERT_EQ(shapeInfer->infer(inputs, 0x2), (std::vector<VectorDims>{{3, 8}}));
+    // the same inputs are memoized for the both ways of the shape inference
+    std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> constant_data;
+    constant_data[1] = std::make_shared<ngraph::runtime::HostTensor>(element::i64, ov::Shape{2}, pattern_val);
+    ASSERT_EQ(shapeInfer->infer({{2, 12}, {2}}, constant_data)[0], (StaticShape{3, 8}));
+
+    pattern_val[0] = 4;
+    pattern_val[1] = 6;
+    ASSERT_EQ(&shapeInfer->infer(inputs, 0x2), &first);
+    inputs.dims[0] = {3, 8};
+    ASSERT_EQ(shapeInfer->infer(inputs, 0x2), (std::vector<VectorDims>{{4, 6}}));
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/core/coordinate_diff.hpp>
+#include <openvino/op/ops.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeInferenceTest, MaxPoolV8DilatedCeilTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto maxPool = std::make_shared<op::v8::MaxPool>(data,
+                                                     Strides{2, 2},
+                                                     Strides{2, 2},
+                                                     Shape{1, 1},
+                                                     Shape{1, 1},
+                                                     Shape{3, 3},
+                                                     op::RoundingType::CEIL);
+    auto shapeInfer = make_shape_inference(maxPool);
+
+    const auto output_shapes = shapeInfer->infer({{1, 3, 10, 10}}, {});
+    ASSERT_EQ(output_shapes.size(), 2);
+    ASSERT_EQ(output_shapes[0], (StaticShape{1, 3, 5, 5}));
+    ASSERT_EQ(output_shapes[1], (StaticShape{1, 3, 5, 5}));
+    ASSERT_EQ(shapeInfer->get_pads_begin(), (CoordinateDiff{1, 1}));
+    ASSERT_EQ(shapeInfer->get_pads_end(), (CoordinateDiff{1, 1}));
+}
+
+TEST(StaticShapeInferenceTest, AvgPoolSameLowerTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto avgPool = std::make_shared<op::v1::AvgPool>(data,
+                                                     Strides{1, 1},
+                                                     Shape{0, 0},
+                                                     Shape{0, 0},
+                                                     Shape{2, 2},
+                                                     true,
+                                                     op::RoundingType::FLOOR,
+                                                     op::PadType::SAME_LOWER);
+    auto shapeInfer = make_shape_inference(avgPool);
+
+    ASSERT_EQ(shapeInfer->infer({{1, 2, 7, 7}}, {})[0], (StaticShape{1, 2, 7, 7}));
+    ASSERT_EQ(shapeInfer->get_pads_begin(), (CoordinateDiff{1, 1}));
+    ASSERT_EQ(shapeInfer->get_pads_end(), (CoordinateDiff{0, 0}));
+}
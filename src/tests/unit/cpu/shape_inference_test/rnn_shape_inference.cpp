@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <rnn_shape_inference.hpp>
+
+#include "utils.hpp"
+
+using namespace ov;
+using namespace ov::intel_cpu;
+using namespace std;
+
+namespace {
+shared_ptr<op::v0::Parameter> make_param() {
+    return make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+}
+}  // namespace
+
+TEST(StaticShapeInferenceTest, RNNCellV0) {
+    auto cell = make_shared<op::v0::RNNCell>(make_param(), make_param(), make_param(), make_param(), make_param(), 16);
+
+    check_static_shape(cell.get(),
+                       {StaticShape{2, 8}, StaticShape{2, 16}, StaticShape{16, 8}, StaticShape{16, 16}, StaticShape{16}},
+                       {StaticShape{2, 16}});
+}
+
+TEST(StaticShapeInferenceTest, GRUCellV3) {
+    auto cell = make_shared<op::v3::GRUCell>(make_param(), make_param(), make_param(), make_param(), make_param(), 16);
+
+    check_static_shape(cell.get(),
+                       {StaticShape{2, 8}, StaticShape{2, 16}, StaticShape{48, 8}, StaticShape{48, 16}, StaticShape{48}},
+                       {StaticShape{2, 16}});
+    EXPECT_THROW(check_static_shape(cell.get(),
+                                    {StaticShape{2, 8},
+                                     StaticShape{3, 16},
+                                     StaticShape{48, 8},
+                                     StaticShape{48, 16},
+                                     StaticShape{48}},
+                                    {StaticShape{}}),
+                 NodeValidationFailure);
+}
+
+TEST(StaticShapeInferenceTest, GRUSequenceV5) {
+    auto seq = make_shared<op::v5::GRUSequence>(make_param(),
+                                                make_param(),
+                                                make_param(),
+                                                make_param(),
+                                                make_param(),
+                                                make_param(),
+                                                16,
+                                                op::RecurrentSequenceDirection::FORWARD);
+
+    check_static_shape(seq.get(),
+                       {StaticShape{2, 5, 8},
+                        StaticShape{2, 1, 16},
+                        StaticShape{2},
+                        StaticShape{1, 48, 8},
+                        StaticShape{1, 48, 16},
+                        StaticShape{1, 48}},
+                       {StaticShape{2, 1, 5, 16}, StaticShape{2, 1, 16}});
+}
+
+TEST(StaticShapeInferenceTest, LSTMSequenceV5Bidirectional) {
+    auto seq = make_shared<op::v5::LSTMSequence>(make_param(),
+                                                 make_param(),
+                                                 make_param(),
+                                                 make_param(),
+                                                 make_param(),
+                                                 make_param(),
+                                                 make_param(),
+                                                 6,
+                                                 op::RecurrentSequenceDirection::BIDIRECTIONAL);
+
+    check_static_shape(seq.get(),
+                       {StaticShape{3, 7, 4},
+                        StaticShape{3, 2, 6},
+                        StaticShape{3, 2, 6},
+                        StaticShape{3},
+                        StaticShape{2, 24, 4},
+                        StaticShape{2, 24, 6},
+                        StaticShape{2, 24}},
+                       {StaticShape{3, 2, 7, 6}, StaticShape{3, 2, 6}, StaticShape{3, 2, 6}});
+    // the states of one direction don't match the bidirectional sequence
+    EXPECT_THROW(check_static_shape(seq.get(),
+                                    {StaticShape{3, 7, 4},
+                                     StaticShape{3, 1, 6},
+                                     StaticShape{3, 1, 6},
+                                     StaticShape{3},
+                                     StaticShape{2, 24, 4},
+                                     StaticShape{2, 24, 6},
+                                     StaticShape{2, 24}},
+                                    {StaticShape{}, StaticShape{}, StaticShape{}}),
+                 NodeValidationFailure);
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <roi_pooling_shape_inference.hpp>
+
+#include "utils.hpp"
+
+using namespace ov;
+using namespace ov::intel_cpu;
+using namespace std;
+
+TEST(StaticShapeInferenceTest, ROIPoolingV0) {
+    auto feat_maps = make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto coords = make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto roi_pooling = make_shared<op::v0::ROIPooling>(feat_maps, coords, Shape{6, 6}, 0.0625f, "max");
+
+    check_static_shape(roi_pooling.get(), {StaticShape{1, 3, 20, 20}, StaticShape{7, 5}}, {StaticShape{7, 3, 6, 6}});
+    EXPECT_THROW(check_static_shape(roi_pooling.get(), {StaticShape{1, 3, 20, 20}, StaticShape{7, 4}}, {StaticShape{}}),
+                 NodeValidationFailure);
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/opsets/opset.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+
+#include <set>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+namespace {
+// The operations of the opsets supported by the plugin, which shape inference may still fall back to the validation of
+// the operation clone. Either the plugin infers their output shapes itself or they don't reach the dynamic inference.
+const std::set<NodeTypeInfo>& fallback_allowed_ops() {
+    static const std::set<NodeTypeInfo> ops = {
+        // nothing to infer
+        op::v0::Constant::get_type_info_static(),
+        op::v0::Parameter::get_type_info_static(),
+        op::v0::Result::get_type_info_static(),
+        // the nodes infer the shapes of their bodies
+        op::v0::TensorIterator::get_type_info_static(),
+        op::v5::Loop::get_type_info_static(),
+        op::v8::If::get_type_info_static(),
+        // the output shapes depend on the output data, which the nodes define at execution
+        op::v1::NonMaxSuppression::get_type_info_static(),
+        op::v3::NonMaxSuppression::get_type_info_static(),
+        op::v4::NonMaxSuppression::get_type_info_static(),
+        op::v5::NonMaxSuppression::get_type_info_static(),
+        op::v8::MatrixNms::get_type_info_static(),
+        op::v8::MulticlassNms::get_type_info_static(),
+        op::v3::NonZero::get_type_info_static(),
+        op::v8::RandomUniform::get_type_info_static(),
+        // the nodes override the shape inference
+        op::v0::PriorBox::get_type_info_static(),
+        op::v8::PriorBox::get_type_info_static(),
+        op::v0::PriorBoxClustered::get_type_info_static(),
+        op::v8::AdaptiveAvgPool::get_type_info_static(),
+        op::v8::AdaptiveMaxPool::get_type_info_static(),
+        op::v8::I420toBGR::get_type_info_static(),
+        op::v8::I420toRGB::get_type_info_static(),
+        op::v8::NV12toBGR::get_type_info_static(),
+        op::v8::NV12toRGB::get_type_info_static(),
+        // the padding fallback
+        op::v1::DeformableConvolution::get_type_info_static(),
+        op::v8::DeformableConvolution::get_type_info_static(),
+        // the static shapes only or decomposed by the common transformations
+        op::v1::BinaryConvolution::get_type_info_static(),
+        op::v0::PSROIPooling::get_type_info_static(),
+        op::v1::DeformablePSROIPooling::get_type_info_static(),
+        op::v0::BatchNormInference::get_type_info_static(),
+        op::v0::LSTMSequence::get_type_info_static(),
+    };
+    return ops;
+}
+}  // namespace
+
+// Fails when an operation falls back to the validation of the operation clone without being allowed to, so the new
+// operations get the static shape inference of their own, and when an allowed one doesn't fall back anymore
+TEST(StaticShapeInferenceTest, FallbackCoverage) {
+    std::set<NodeTypeInfo> type_infos;
+    for (const auto& opset : {&get_opset1(), &get_opset2(), &get_opset3(), &get_opset4(),
+                              &get_opset5(), &get_opset6(), &get_opset7(), &get_opset8()}) {
+        for (const auto& type_info : opset->get_type_info_set()) {
+            if (!type_infos.insert(type_info).second)
+                continue;
+            std::shared_ptr<Node> op(opset->create(type_info.name));
+            if (!op)
+                continue;
+            const bool is_allowed = fallback_allowed_ops().count(type_info) != 0;
+            EXPECT_EQ(has_native_shape_inference(op), !is_allowed)
+                << type_info << (is_allowed ? " has the native shape inference, remove it from the allowed ops"
+                                            : " falls back to the validation of the operation clone");
+        }
+    }
+
+    ASSERT_TRUE(has_native_shape_inference(std::make_shared<opset1::Transpose>()));
+    ASSERT_TRUE(has_native_shape_inference(std::make_shared<opset1::Concat>()));
+    ASSERT_TRUE(has_native_shape_inference(std::make_shared<opset1::MaxPool>()));
+    ASSERT_TRUE(has_native_shape_inference(std::make_shared<opset8::MaxPool>()));
+    ASSERT_TRUE(has_native_shape_inference(std::make_shared<opset1::AvgPool>()));
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <slice_shape_inference.hpp>
+
+#include "utils.hpp"
+
+using namespace ov;
+using namespace ov::intel_cpu;
+using namespace std;
+
+TEST(StaticShapeInferenceTest, SliceWithAxes) {
+    auto data = make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto start = make_shared<op::v0::Parameter>(element::i64, PartialShape::dynamic());
+    auto stop = make_shared<op::v0::Parameter>(element::i64, PartialShape::dynamic());
+    auto step = make_shared<op::v0::Parameter>(element::i64, PartialShape::dynamic());
+    auto axes = make_shared<op::v0::Parameter>(element::i64, PartialShape::dynamic());
+    auto slice = make_shared<op::v8::Slice>(data, start, stop, step, axes);
+
+    check_static_shape(slice.get(),
+                       {StaticShape{10, 20, 30}, {1, -5, 15}, {8, 100, 2}, {2, 1, -3}, {0, 2, 1}},
+                       {StaticShape{4, 5, 5}});
+    // the empty range slices nothing
+    check_static_shape(slice.get(),
+                       {StaticShape{10, 20, 30}, {5}, {2}, {1}, {-1}},
+                       {StaticShape{10, 20, 0}});
+}
+
+TEST(StaticShapeInferenceTest, SliceDefaultAxes) {
+    auto data = make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto start = make_shared<op::v0::Parameter>(element::i64, PartialShape::dynamic());
+    auto stop = make_shared<op::v0::Parameter>(element::i64, PartialShape::dynamic());
+    auto step = make_shared<op::v0::Parameter>(element::i64, PartialShape::dynamic());
+    auto slice = make_shared<op::v8::Slice>(data, start, stop, step);
+
+    check_static_shape(slice.get(), {StaticShape{10, 20, 30}, {0}, {-1}, {1}}, {StaticShape{9, 20, 30}});
+    EXPECT_THROW(check_static_shape(slice.get(), {StaticShape{10, 20, 30}, {0}, {-1}, {0}}, {StaticShape{}}),
+                 NodeValidationFailure);
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/ops.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeInferenceTest, TransposeTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto order = op::v0::Constant::create(element::i64, Shape{3}, {2, 0, 1});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{3}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({4, 2, 3}));
+}
+
+TEST(StaticShapeInferenceTest, TransposeEmptyOrderTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto order = op::v0::Constant::create(element::i64, Shape{0}, std::vector<int64_t>{});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{0}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({4, 3, 2}));
+}
+
+TEST(StaticShapeInferenceTest, TransposeOrderFromConstantDataTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto order = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{4});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    int32_t order_val[] = {0, 2, 3, 1};
+    std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> constant_data;
+    constant_data[1] = std::make_shared<ngraph::runtime::HostTensor>(element::i32, Shape{4}, order_val);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 3, 8, 16}, StaticShape{4}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes, constant_data);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({1, 8, 16, 3}));
+
+    // the repeated axis is not a permutation
+    order_val[3] = 2;
+    ASSERT_THROW(shape_inference(transpose.get(), static_input_shapes, static_output_shapes, constant_data),
+                 ov::NodeValidationFailure);
+}
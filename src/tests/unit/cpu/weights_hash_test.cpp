@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <weights_cache.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// The former WeightsSharing hash: bytewise 64-bit CRC, as specified in ECMA-182
+class ReferenceCRC64 {
+public:
+    ReferenceCRC64() {
+        for (int i = 0; i < 256; i++) {
+            uint64_t c = i;
+            for (int j = 0; j < 8; j++)
+                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+            table[i] = c;
+        }
+    }
+
+    uint64_t hash(const unsigned char* data, size_t size) const {
+        uint64_t crc = 0;
+        for (size_t idx = 0; idx < size; idx++)
+            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+        return ~crc;
+    }
+
+private:
+    uint64_t table[256];
+};
+
+std::vector<unsigned char> generateData(size_t size, unsigned seed = 42) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<unsigned char> data(size);
+    for (auto& v : data)
+        v = static_cast<unsigned char>(dist(gen));
+    return data;
+}
+
+// fp32 weights of the typical convolution and fully connected layers (ResNet-50 like)
+std::vector<std::vector<float>> generateWeights() {
+    const std::vector<size_t> sizes = {64 * 3 * 7 * 7, 64 * 64 * 3 * 3, 256 * 64, 512 * 512 * 3 * 3, 2048 * 1000};
+    std::mt19937 gen(42);
+    std::normal_distribution<float> dist(0.f, 0.05f);
+    std::vector<std::vector<float>> weights;
+    for (auto size : sizes) {
+        std::vector<float> tensor(size);
+        for (auto& v : tensor)
+            v = dist(gen);
+        weights.push_back(std::move(tensor));
+    }
+    return weights;
+}
+
+uint64_t hash(const std::vector<unsigned char>& data) {
+    return WeightsSharing::GetHashFunc().hash(data.data(), data.size());
+}
+
+}  // namespace
+
+TEST(WeightsHashTest, Deterministic) {
+    for (size_t size : {0, 1, 7, 31, 32, 33, 100, 1024, 4099}) {
+        auto data = generateData(size);
+        auto copy = data;
+        ASSERT_EQ(hash(data), hash(copy)) << "size = " << size;
+    }
+}
+
+TEST(WeightsHashTest, SensitiveToEachBit) {
+    // covers the lanes boundaries and the tail handling
+    for (size_t size = 1; size < 300; size++) {
+        auto data = generateData(size, static_cast<unsigned>(size));
+        const auto refHash = hash(data);
+        for (size_t i = 0; i < size; i++) {
+            for (int bit = 0; bit < 8; bit++) {
+                data[i] ^= static_cast<unsigned char>(1 << bit);
+                ASSERT_NE(refHash, hash(data)) << "size = " << size << " byte = " << i << " bit = " << bit;
+                data[i] ^= static_cast<unsigned char>(1 << bit);
+            }
+        }
+    }
+}
+
+TEST(WeightsHashTest, SensitiveToSize) {
+    std::set<uint64_t> hashes;
+    for (size_t size = 0; size < 300; size++) {
+        std::vector<unsigned char> zeros(size, 0);
+        ASSERT_TRUE(hashes.insert(hash(zeros)).second) << "size = " << size;
+    }
+}
+
+TEST(WeightsHashTest, SensitiveToLanesOrder) {
+    // four equal sized chunks, each lane processes one of them
+    auto data = generateData(4 * 64);
+    const auto refHash = hash(data);
+
+    auto swapped = data;
+    std::swap_ranges(swapped.begin(), swapped.begin() + 64, swapped.begin() + 128);
+    ASSERT_NE(refHash, hash(swapped));
+
+    // equal chunks
+    std::vector<unsigned char> repeated(data.begin(), data.begin() + 64);
+    for (int i = 0; i < 3; i++)
+        repeated.insert(repeated.end(), data.begin(), data.begin() + 64);
+    auto shifted = repeated;
+    std::rotate(shifted.begin(), shifted.begin() + 1, shifted.end());
+    ASSERT_NE(hash(repeated), hash(shifted));
+}
+
+// Microbenchmark, run with --gtest_also_run_disabled_tests --gtest_filter=*WeightsHashBenchmark*
+TEST(WeightsHashBenchmark, DISABLED_CompareWithCRC64) {
+    const auto weights = generateWeights();
+    const ReferenceCRC64 reference;
+    const int iterations = 10;
+
+    auto measure = [&](const char* name, std::function<uint64_t(const unsigned char*, size_t)> func) {
+        size_t bytes = 0;
+        uint64_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            for (const auto& tensor : weights) {
+                const auto size = tensor.size() * sizeof(float);
+                checksum ^= func(reinterpret_cast<const unsigned char*>(tensor.data()), size);
+                bytes += size;
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << name << ": " << bytes / elapsed.count() / (1 << 30) << " GB/s (checksum " << checksum << ")" << std::endl;
+        return elapsed.count();
+    };
+
+    const auto refTime = measure("ECMA-182 CRC64", [&](const unsigned char* data, size_t size) {
+        return reference.hash(data, size);
+    });
+    const auto newTime = measure("WeightsSharing hash", [&](const unsigned char* data, size_t size) {
+        return WeightsSharing::GetHashFunc().hash(data, size);
+    });
+    std::cout << "Speedup: " << refTime / newTime << "x" << std::endl;
+
+    std::set<uint64_t> hashes;
+    for (const auto& tensor : weights) {
+        hashes.insert(WeightsSharing::GetHashFunc().hash(reinterpret_cast<const unsigned char*>(tensor.data()),
+                                                         tensor.size() * sizeof(float)));
+    }
+    ASSERT_EQ(hashes.size(), weights.size());
+}